@@ -67,6 +67,7 @@ namespace Byte {
 
 					InstanceRenderer rendererComponent{ sphereGroup.assetID() };
 					EntityID meshEntity{ scene.world().create<InstanceRenderer, Transform>(std::move(rendererComponent), Transform{}) };
+					scene.world().attach(meshEntity, RenderedByGroup{ sphereGroup.assetID() });
 					auto& meshTransform{ scene.world().get<Transform>(meshEntity) };
 					meshTransform.position(position);
 					sphereGroup.submit(meshEntity, meshTransform);
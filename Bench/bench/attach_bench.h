@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+
+#include "ecs/ecs.h"
+#include "bench.h"
+#include "serializer_bench.h"
+
+namespace Byte {
+
+	struct BenchTag {
+		int value{};
+	};
+
+	inline constexpr size_t BENCH_TOGGLED{ 100000 };
+
+	template<typename WorldType>
+	void benchAttachDetach(const char* kind) {
+		using EntityID = typename WorldType::EntityID;
+
+		std::string prefix{ std::string{ kind } + " " };
+
+		WorldType world;
+		std::vector<EntityID> ids;
+		ids.reserve(BENCH_TOGGLED);
+		for (size_t _index{}; _index < BENCH_TOGGLED; ++_index) {
+			float value{ static_cast<float>(_index) };
+			ids.push_back(world.create(BenchPosition{ value, value, value }, BenchVelocity{ value, value, value }));
+		}
+
+		BenchRegistry::measure((prefix + "attach").c_str(), BENCH_TOGGLED, [&]() {
+			for (EntityID id : ids) {
+				world.attach(id, BenchTag{ 1 });
+			}
+			for (EntityID id : ids) {
+				world.template detach<BenchTag>(id);
+			}
+		});
+
+		BenchRegistry::measure((prefix + "toggle").c_str(), BENCH_TOGGLED, [&]() {
+			for (EntityID id : ids) {
+				world.attach(id, BenchTag{ 1 });
+				world.template detach<BenchTag>(id);
+			}
+		});
+
+		BenchRegistry::measure((prefix + "batched toggle").c_str(), BENCH_TOGGLED, [&]() {
+			CommandBuffer<WorldType> attach{ world };
+			for (EntityID id : ids) {
+				attach.attach(id, BenchTag{ 1 });
+			}
+			attach.playback();
+
+			CommandBuffer<WorldType> detach{ world };
+			for (EntityID id : ids) {
+				detach.template detach<BenchTag>(id);
+			}
+			detach.playback();
+		});
+	}
+
+	BYTE_BENCH(attachDetach) {
+		benchAttachDetach<VectorWorld>("vector");
+		benchAttachDetach<World>("chunked");
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+namespace Byte {
+
+	class BenchRegistry {
+	private:
+		struct Bench {
+			const char* name;
+			void (*function)();
+		};
+
+		using Clock = std::chrono::steady_clock;
+
+		inline static std::vector<Bench> _benches;
+
+	public:
+		inline static constexpr size_t REPEATS{ 5 };
+
+		static bool add(const char* name, void (*function)()) {
+			_benches.push_back(Bench{ name, function });
+			return true;
+		}
+
+		template<typename Function>
+		static double measure(const char* label, size_t items, Function&& function, size_t repeats = REPEATS) {
+			double best{};
+			for (size_t _index{}; _index < repeats; ++_index) {
+				Clock::time_point start{ Clock::now() };
+				function();
+				double elapsed{ std::chrono::duration<double, std::milli>(Clock::now() - start).count() };
+				best = _index ? std::min(best, elapsed) : elapsed;
+			}
+
+			std::cout << "  " << std::left << std::setw(40) << label << std::right << std::fixed
+				<< std::setprecision(3) << std::setw(10) << best << " ms"
+				<< std::setprecision(2) << std::setw(10) << best * 1e6 / static_cast<double>(items ? items : 1) << " ns/item\n";
+			return best;
+		}
+
+		static int run(int argc, char** argv) {
+			for (const Bench& bench : _benches) {
+				bool selected{ argc < 2 };
+				for (int _index{ 1 }; _index < argc; ++_index) {
+					selected = selected || std::string{ bench.name }.find(argv[_index]) != std::string::npos;
+				}
+
+				if (selected) {
+					std::cout << bench.name << "\n";
+					bench.function();
+				}
+			}
+			return 0;
+		}
+	};
+
+	inline volatile double benchSink{};
+
+	inline void keep(double value) {
+		benchSink = value;
+	}
+
+}
+
+#define BYTE_BENCH(name) \
+	static void name(); \
+	inline const bool name##Registered{ Byte::BenchRegistry::add(#name, &name) }; \
+	static void name()
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "ecs/ecs.h"
+#include "bench.h"
+
+namespace Byte {
+
+	inline std::vector<EntityID> benchKeys(size_t count, uint64_t seed) {
+		std::mt19937_64 generator{ seed };
+		std::vector<EntityID> out(count);
+		for (EntityID& key : out) {
+			key = EntityID{ generator() | 1 };
+		}
+		return out;
+	}
+
+	template<typename Map>
+	void benchMap(const char* kind, size_t count) {
+		std::vector<EntityID> keys{ benchKeys(count, count) };
+		std::vector<EntityID> misses{ benchKeys(count, ~count) };
+		std::string prefix{ std::string{ kind } + " " + std::to_string(count) + " " };
+		size_t repeats{ count >= 1000000 ? 1 : BenchRegistry::REPEATS };
+
+		Map map;
+		BenchRegistry::measure((prefix + "insert").c_str(), count, [&]() {
+			map = Map{};
+			for (size_t _index{}; _index < count; ++_index) {
+				map.emplace(keys[_index], _index);
+			}
+		}, repeats);
+
+		BenchRegistry::measure((prefix + "lookup").c_str(), count, [&]() {
+			size_t sum{};
+			for (const EntityID& key : keys) {
+				sum += map.find(key)->second;
+			}
+			keep(static_cast<double>(sum));
+		}, repeats);
+
+		BenchRegistry::measure((prefix + "miss").c_str(), count, [&]() {
+			size_t found{};
+			for (const EntityID& key : misses) {
+				found += map.find(key) != map.end();
+			}
+			keep(static_cast<double>(found));
+		}, repeats);
+
+		BenchRegistry::measure((prefix + "erase").c_str(), count, [&]() {
+			for (const EntityID& key : keys) {
+				map.erase(key);
+			}
+		}, 1);
+	}
+
+	BYTE_BENCH(hashMap) {
+		for (size_t count{ 1000 }; count <= 10000000; count *= 10) {
+			benchMap<hash_map<EntityID, size_t>>("hash_map", count);
+			benchMap<std::unordered_map<EntityID, size_t>>("unordered_map", count);
+		}
+	}
+
+}
\ No newline at end of file
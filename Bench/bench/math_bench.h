@@ -0,0 +1,160 @@
+#pragma once
+
+#include <span>
+#include <random>
+#include <vector>
+
+#include "core/transform.h"
+#include "bench.h"
+
+namespace Byte {
+
+	inline constexpr size_t BENCH_MATH{ 100000 };
+	inline constexpr size_t BENCH_MATH_PASSES{ 20 };
+
+	template<typename Function>
+	void measureMath(const char* label, Function&& function) {
+		BenchRegistry::measure(label, BENCH_MATH * BENCH_MATH_PASSES, [&]() {
+			for (size_t pass{}; pass < BENCH_MATH_PASSES; ++pass) {
+				function();
+			}
+		});
+	}
+
+	inline Mat4 scalarMultiply(const Mat4& left, const Mat4& right) {
+		Mat4 out{ 0 };
+		for (size_t i{}; i < 4; ++i) {
+			for (size_t j{}; j < 4; ++j) {
+				for (size_t k{}; k < 4; ++k) {
+					out(i, j) += left(i, k) * right(k, j);
+				}
+			}
+		}
+		return out;
+	}
+
+	inline Vec4 scalarTransform(const Mat4& mat, const Vec4& vec) {
+		return Vec4{
+			mat(0, 0) * vec.x + mat(0, 1) * vec.y + mat(0, 2) * vec.z + mat(0, 3) * vec.w,
+			mat(1, 0) * vec.x + mat(1, 1) * vec.y + mat(1, 2) * vec.z + mat(1, 3) * vec.w,
+			mat(2, 0) * vec.x + mat(2, 1) * vec.y + mat(2, 2) * vec.z + mat(2, 3) * vec.w,
+			mat(3, 0) * vec.x + mat(3, 1) * vec.y + mat(3, 2) * vec.z + mat(3, 3) * vec.w };
+	}
+
+	inline Mat4 scalarInverse(const Mat4& mat) {
+		float det{ mat.determinant() };
+		if (det == 0) {
+			return Mat4::identity();
+		}
+		return mat.cofactor().transposed() / det;
+	}
+
+	inline Vec3 scalarRotate(const Quaternion& rotation, const Vec3& vec) {
+		Quaternion out{ rotation * Quaternion{ 0.0f, vec.x, vec.y, vec.z } * rotation.conjugated() };
+		return Vec3{ out.x, out.y, out.z };
+	}
+
+	inline void scalarTransformPoints(std::span<Vec3> points, const Mat4& mat) {
+		for (Vec3& point : points) {
+			Vec4 out{ scalarTransform(mat, Vec4{ point.x, point.y, point.z, 1.0f }) };
+			point = Vec3{ out.x, out.y, out.z };
+		}
+	}
+
+	inline std::vector<TransformData> benchTransforms(size_t count) {
+		std::mt19937 generator{ 7 };
+		std::uniform_real_distribution<float> distribution{ -10.0f, 10.0f };
+
+		std::vector<TransformData> out(count);
+		for (TransformData& data : out) {
+			data.position = Vec3{ distribution(generator), distribution(generator), distribution(generator) };
+			data.scale = Vec3{ 1.5f, 0.5f, 2.0f };
+			data.rotation = Quaternion{ distribution(generator) * 18.0f, distribution(generator) * 18.0f, distribution(generator) * 18.0f };
+		}
+		return out;
+	}
+
+	BYTE_BENCH(math) {
+		std::vector<TransformData> transforms{ benchTransforms(BENCH_MATH) };
+		std::vector<Mat4> matrices(BENCH_MATH);
+		std::vector<Mat4> results(BENCH_MATH);
+		std::vector<Vec3> points(BENCH_MATH);
+
+		for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+			matrices[_index] = composeTRS(transforms[_index]);
+			points[_index] = transforms[_index].position;
+		}
+		Mat4 rigid{ composeTRS(TransformData{ Vec3{ 0.5f, -0.25f, 1.0f }, Vec3{ 1.0f, 1.0f, 1.0f }, transforms.front().rotation }) };
+
+		measureMath("scalar Mat4 * Mat4", [&]() {
+			for (size_t _index{ 1 }; _index < BENCH_MATH; ++_index) {
+				results[_index] = scalarMultiply(matrices[_index - 1], matrices[_index]);
+			}
+		});
+		measureMath("simd Mat4 * Mat4", [&]() {
+			for (size_t _index{ 1 }; _index < BENCH_MATH; ++_index) {
+				results[_index] = matrices[_index - 1] * matrices[_index];
+			}
+		});
+
+		measureMath("scalar Mat4 * Vec4", [&]() {
+			float sum{};
+			for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+				sum += scalarTransform(matrices[_index], Vec4{ 1.0f, 2.0f, 3.0f, 1.0f }).x;
+			}
+			keep(sum);
+		});
+		measureMath("simd Mat4 * Vec4", [&]() {
+			float sum{};
+			for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+				sum += (matrices[_index] * Vec4{ 1.0f, 2.0f, 3.0f, 1.0f }).x;
+			}
+			keep(sum);
+		});
+
+		measureMath("scalar inverse", [&]() {
+			for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+				results[_index] = scalarInverse(matrices[_index]);
+			}
+		});
+		measureMath("simd inverse", [&]() {
+			for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+				results[_index] = matrices[_index].inverse();
+			}
+		});
+
+		measureMath("two-product rotation", [&]() {
+			float sum{};
+			for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+				sum += scalarRotate(transforms[_index].rotation, points[_index]).x;
+			}
+			keep(sum);
+		});
+		measureMath("rotation", [&]() {
+			float sum{};
+			for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+				sum += (transforms[_index].rotation * points[_index]).x;
+			}
+			keep(sum);
+		});
+
+		measureMath("scalar transformPoints", [&]() {
+			scalarTransformPoints(points, rigid);
+		});
+		measureMath("simd transformPoints", [&]() {
+			transformPoints(points, rigid);
+		});
+
+		measureMath("scalar composeTRS", [&]() {
+			for (size_t _index{}; _index < BENCH_MATH; ++_index) {
+				results[_index] = composeTRS(transforms[_index]);
+			}
+		});
+		measureMath("simd composeTRS", [&]() {
+			composeTRS(transforms, results);
+		});
+
+		keep(results.back().data[0] + points.back().x);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <span>
+#include <thread>
+#include <string>
+#include <vector>
+
+#include "core/transform.h"
+#include "ecs/ecs.h"
+#include "bench.h"
+#include "serializer_bench.h"
+
+namespace Byte {
+
+	inline std::vector<size_t> benchThreadCounts() {
+		size_t hardware{ std::max<size_t>(std::thread::hardware_concurrency(), 1) };
+
+		std::vector<size_t> out;
+		for (size_t threads{ 1 }; threads < hardware; threads *= 2) {
+			out.push_back(threads);
+		}
+		out.push_back(hardware);
+		return out;
+	}
+
+	template<typename WorldType>
+	void benchScheduler(const char* kind) {
+		WorldType world;
+		for (size_t _index{}; _index < BENCH_ENTITIES; ++_index) {
+			float value{ static_cast<float>(_index % 1024) };
+			world.create(TransformData{ Vec3{ value, 0.0f, -value } }, BenchVelocity{ 1.0f, 2.0f, 3.0f }, Mat4{});
+		}
+
+		for (size_t threads : benchThreadCounts()) {
+			Scheduler<WorldType> scheduler{ threads - 1 };
+			scheduler.template system<Read<BenchVelocity>, Write<TransformData, Mat4>>([](WorldType& world, ThreadPool& pool) {
+				world.template components<TransformData, const BenchVelocity, Mat4>().eachChunk(pool,
+					[](size_t count, TransformData* transforms, const BenchVelocity* velocities, Mat4* models) {
+						for (size_t _index{}; _index < count; ++_index) {
+							transforms[_index].position += Vec3{ velocities[_index].x, velocities[_index].y, velocities[_index].z } * 0.016f;
+						}
+						composeTRS(std::span<const TransformData>{ transforms, count }, std::span<Mat4>{ models, count });
+					});
+			});
+
+			std::string label{ std::string{ kind } + " " + std::to_string(threads) + (threads == 1 ? " thread" : " threads") };
+			BenchRegistry::measure(label.c_str(), BENCH_ENTITIES, [&]() {
+				world.nextTick();
+				scheduler.run(world);
+			});
+		}
+	}
+
+	BYTE_BENCH(scheduler) {
+		benchScheduler<VectorWorld>("vector");
+		benchScheduler<World>("chunked");
+	}
+
+}
\ No newline at end of file
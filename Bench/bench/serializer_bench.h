@@ -0,0 +1,79 @@
+#pragma once
+
+#include <string>
+#include <filesystem>
+
+#include "ecs/ecs.h"
+#include "bench.h"
+
+namespace Byte {
+
+	struct BenchPosition {
+		float x{};
+		float y{};
+		float z{};
+	};
+
+	struct BenchVelocity {
+		float x{};
+		float y{};
+		float z{};
+	};
+
+	inline constexpr size_t BENCH_ENTITIES{ 1000000 };
+
+	template<typename WorldType>
+	void fillBenchWorld(WorldType& world, size_t count) {
+		for (size_t _index{}; _index < count; ++_index) {
+			float value{ static_cast<float>(_index) };
+			if (_index % 4) {
+				world.create(BenchPosition{ value, value, value }, BenchVelocity{ 1.0f, 0.0f, 0.0f });
+			}
+			else {
+				world.create(BenchPosition{ value, value, value });
+			}
+		}
+	}
+
+	template<typename WorldType>
+	double sumPositions(WorldType& world) {
+		double sum{};
+		for (auto [position] : world.template components<const BenchPosition>()) {
+			sum += position.x;
+		}
+		return sum;
+	}
+
+	template<typename WorldType>
+	void benchSerializer(const char* kind) {
+		using Serial = Serializer<WorldType>;
+
+		std::string path{ (std::filesystem::temp_directory_path() / (std::string{ "byte_bench_" } + kind + ".bin")).string() };
+		std::string prefix{ std::string{ kind } + " " };
+
+		WorldType world;
+		fillBenchWorld(world, BENCH_ENTITIES);
+
+		BenchRegistry::measure((prefix + "save").c_str(), BENCH_ENTITIES, [&]() {
+			Serial::template save<BenchPosition, BenchVelocity>(world, path);
+		});
+
+		BenchRegistry::measure((prefix + "load").c_str(), BENCH_ENTITIES, [&]() {
+			WorldType loaded{ Serial::template load<BenchPosition, BenchVelocity>(path) };
+			keep(static_cast<double>(loaded.size()));
+		});
+
+		BenchRegistry::measure((prefix + "load and read").c_str(), BENCH_ENTITIES, [&]() {
+			WorldType loaded{ Serial::template load<BenchPosition, BenchVelocity>(path) };
+			keep(sumPositions(loaded));
+		});
+
+		std::filesystem::remove(path);
+	}
+
+	BYTE_BENCH(serializer) {
+		benchSerializer<VectorWorld>("vector");
+		benchSerializer<World>("chunked");
+	}
+
+}
\ No newline at end of file
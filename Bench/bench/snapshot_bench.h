@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+
+#include "ecs/ecs.h"
+#include "bench.h"
+#include "serializer_bench.h"
+
+namespace Byte {
+
+	inline constexpr size_t BENCH_SNAPSHOT{ 500000 };
+
+	template<typename WorldType, typename... Components>
+	void writeBenchWorld(WorldType& world) {
+		for (auto [position, velocity] : world.template components<BenchPosition, Components...>()) {
+			position.x += velocity.x;
+		}
+	}
+
+	template<typename WorldType>
+	void benchSnapshot(const char* kind) {
+		std::string prefix{ std::string{ kind } + " " };
+
+		WorldType world;
+		fillBenchWorld(world, BENCH_SNAPSHOT);
+
+		BenchRegistry::measure((prefix + "snapshot").c_str(), BENCH_SNAPSHOT, [&]() {
+			WorldType snapshot{ world };
+			keep(static_cast<double>(snapshot.size()));
+		});
+
+		BenchRegistry::measure((prefix + "write").c_str(), BENCH_SNAPSHOT, [&]() {
+			writeBenchWorld<WorldType, const BenchVelocity>(world);
+		});
+
+		BenchRegistry::measure((prefix + "snapshot and write one column").c_str(), BENCH_SNAPSHOT, [&]() {
+			WorldType snapshot{ world };
+			writeBenchWorld<WorldType, const BenchVelocity>(world);
+		});
+
+		BenchRegistry::measure((prefix + "snapshot and write all columns").c_str(), BENCH_SNAPSHOT, [&]() {
+			WorldType snapshot{ world };
+			writeBenchWorld<WorldType, BenchVelocity>(world);
+		});
+	}
+
+	BYTE_BENCH(snapshot) {
+		benchSnapshot<VectorWorld>("vector");
+		benchSnapshot<World>("chunked");
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include "bench.h"
+#include "serializer_bench.h"
+#include "attach_bench.h"
+#include "scheduler_bench.h"
+#include "hash_map_bench.h"
+#include "snapshot_bench.h"
+#include "math_bench.h"
+
+using namespace Byte;
+
+int main(int argc, char** argv) {
+	return BenchRegistry::run(argc, argv);
+}
\ No newline at end of file
@@ -2,15 +2,20 @@
 
 #include <cstdint>
 #include <iostream>
+#include <span>
+#include <type_traits>
 
 #include "vec.h"
 #include "trigonometry.h"
+#include "simd.h"
 
 namespace Byte {
 
     template<size_t Y, size_t X, typename Type>
     struct _Mat {
-        Type data[Y * X];
+        inline static constexpr bool SIMD{ Y == 4 && X == 4 && std::is_same_v<Type, float> };
+
+        alignas(SIMD ? 16 : alignof(Type)) Type data[Y * X];
 
         _Mat() = default;
 
@@ -26,6 +31,8 @@ namespace Byte {
             }
         }
 
+        _Mat& operator=(const _Mat& left) = default;
+
         Type& operator()(size_t row, size_t column) {
             return data[column * Y + row];
         }
@@ -96,6 +103,13 @@ namespace Byte {
 
         template<size_t X2>
         _Mat<Y, X2, Type> operator*(const _Mat<X, X2, Type>& other) const {
+#ifdef BYTE_MATH_SSE
+            if constexpr (SIMD && X2 == 4) {
+                _Mat out;
+                multiplyMat4(data, other.data, out.data);
+                return out;
+            }
+#endif
             _Mat<Y, X2, Type> out{ 0 };
 
             for (size_t i{ 0 }; i < Y; ++i) {
@@ -222,6 +236,15 @@ namespace Byte {
         _Mat inverse() const {
             static_assert(Y == X, "Inverse is defined only for square matrices.");
 
+#ifdef BYTE_MATH_SSE
+            if constexpr (SIMD) {
+                _Mat out;
+                if (!inverseMat4(data, out.data)) {
+                    return _Mat::identity();
+                }
+                return out;
+            }
+#endif
             Type det = this->determinant();
             if (det == 0) {
                 return _Mat::identity();
@@ -341,6 +364,13 @@ namespace Byte {
 
     template<typename Type>
     inline _Vec4<Type> operator*(const _Mat<4, 4, Type>& mat, const _Vec4<Type>& vec) {
+#ifdef BYTE_MATH_SSE
+        if constexpr (std::is_same_v<Type, float>) {
+            _Vec4<Type> out;
+            transformVec4(mat.data, &vec.x, &out.x);
+            return out;
+        }
+#endif
         return _Vec4<Type>(
             mat(0, 0) * vec.x + mat(0, 1) * vec.y + mat(0, 2) * vec.z + mat(0, 3) * vec.w,
             mat(1, 0) * vec.x + mat(1, 1) * vec.y + mat(1, 2) * vec.z + mat(1, 3) * vec.w,
@@ -349,4 +379,37 @@ namespace Byte {
         );
     }
 
+
+    inline void transformPoints(std::span<Vec3> points, const Mat4& mat) {
+        static_assert(sizeof(Vec3) == 3 * sizeof(float), "Points are transformed as packed xyz triples.");
+
+        size_t _index{};
+#ifdef BYTE_MATH_SSE
+        SimdFloat m[12];
+        for (size_t column{}; column < 4; ++column) {
+            for (size_t row{}; row < 3; ++row) {
+                m[column * 3 + row] = SimdFloat::broadcast(mat(row, column));
+            }
+        }
+
+        for (; _index + SimdFloat::WIDTH <= points.size(); _index += SimdFloat::WIDTH) {
+            float* source{ &points[_index].x };
+            SimdFloat x, y, z;
+            SimdFloat::loadPoints(source, x, y, z);
+
+            SimdFloat outX{ x.multiplyAdd(m[0], y.multiplyAdd(m[3], z.multiplyAdd(m[6], m[9]))) };
+            SimdFloat outY{ x.multiplyAdd(m[1], y.multiplyAdd(m[4], z.multiplyAdd(m[7], m[10]))) };
+            SimdFloat outZ{ x.multiplyAdd(m[2], y.multiplyAdd(m[5], z.multiplyAdd(m[8], m[11]))) };
+            SimdFloat::storePoints(source, outX, outY, outZ);
+        }
+#endif
+        for (; _index < points.size(); ++_index) {
+            Vec3& point{ points[_index] };
+            point = Vec3{
+                mat(0, 0) * point.x + mat(0, 1) * point.y + mat(0, 2) * point.z + mat(0, 3),
+                mat(1, 0) * point.x + mat(1, 1) * point.y + mat(1, 2) * point.z + mat(1, 3),
+                mat(2, 0) * point.x + mat(2, 1) * point.y + mat(2, 2) * point.z + mat(2, 3) };
+        }
+    }
+
 }
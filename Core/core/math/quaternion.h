@@ -82,9 +82,17 @@ namespace Byte {
 		}
 
 		_Vec3<Type> operator*(const _Vec3<Type>& vec3) const {
-			_Quaternion result{ (*this) * _Quaternion(0, vec3.x, vec3.y, vec3.z) * conjugated() };
+			_Vec3<Type> axis{ x, y, z };
+			_Vec3<Type> cross{ axis.cross(vec3) };
 
-			return _Vec3<Type>{ result.x, result.y, result.z };
+			Type scalar{ w * w - axis.dot(axis) };
+			Type projection{ 2 * axis.dot(vec3) };
+			Type twoW{ 2 * w };
+
+			return _Vec3<Type>{
+				scalar * vec3.x + projection * x + twoW * cross.x,
+				scalar * vec3.y + projection * y + twoW * cross.y,
+				scalar * vec3.z + projection * z + twoW * cross.z };
 		}
 
 		void operator*=(const _Quaternion& other) {
@@ -0,0 +1,318 @@
+#pragma once
+
+#include <cstddef>
+
+#if !defined(BYTE_MATH_SCALAR)
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define BYTE_MATH_AVX2
+#define BYTE_MATH_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BYTE_MATH_SSE
+#endif
+#endif
+
+namespace Byte {
+
+#ifdef BYTE_MATH_SSE
+	template<int Mask>
+	inline __m128 shuffle(__m128 left, __m128 right) {
+		return _mm_shuffle_ps(left, right, Mask);
+	}
+
+	template<int Mask>
+	inline __m128 swizzle(__m128 value) {
+		return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(value), Mask));
+	}
+
+	inline __m128 unpackLow(__m128 left, __m128 right) {
+		return _mm_unpacklo_ps(left, right);
+	}
+
+#ifdef BYTE_MATH_AVX2
+	template<int Mask>
+	inline __m256 shuffle(__m256 left, __m256 right) {
+		return _mm256_shuffle_ps(left, right, Mask);
+	}
+
+	inline __m256 unpackLow(__m256 left, __m256 right) {
+		return _mm256_unpacklo_ps(left, right);
+	}
+#endif
+
+	inline __m128 multiplyAdd(__m128 left, __m128 right, __m128 add) {
+#ifdef BYTE_MATH_AVX2
+		return _mm_fmadd_ps(left, right, add);
+#else
+		return _mm_add_ps(_mm_mul_ps(left, right), add);
+#endif
+	}
+
+	struct SimdFloat4 {
+		inline static constexpr size_t WIDTH{ 4 };
+
+		__m128 value;
+
+		static SimdFloat4 broadcast(float value) {
+			return SimdFloat4{ _mm_set1_ps(value) };
+		}
+
+		static SimdFloat4 load(const float* source) {
+			return SimdFloat4{ _mm_loadu_ps(source) };
+		}
+
+		static SimdFloat4 gather(const float* source, size_t stride) {
+			return SimdFloat4{ _mm_setr_ps(source[0], source[stride], source[2 * stride], source[3 * stride]) };
+		}
+
+		static void loadPoints(const float* source, SimdFloat4& x, SimdFloat4& y, SimdFloat4& z) {
+			deinterleave(_mm_loadu_ps(source), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x.value, y.value, z.value);
+		}
+
+		static void storePoints(float* dest, SimdFloat4 x, SimdFloat4 y, SimdFloat4 z) {
+			__m128 first, second, third;
+			interleave(x.value, y.value, z.value, first, second, third);
+			_mm_storeu_ps(dest, first);
+			_mm_storeu_ps(dest + 4, second);
+			_mm_storeu_ps(dest + 8, third);
+		}
+
+		static void storeColumns(float* dest, size_t stride, SimdFloat4 x, SimdFloat4 y, SimdFloat4 z, SimdFloat4 w) {
+			_MM_TRANSPOSE4_PS(x.value, y.value, z.value, w.value);
+			_mm_storeu_ps(dest, x.value);
+			_mm_storeu_ps(dest + stride, y.value);
+			_mm_storeu_ps(dest + 2 * stride, z.value);
+			_mm_storeu_ps(dest + 3 * stride, w.value);
+		}
+
+		static void storeColumns(float* dest, size_t stride, SimdFloat4 x, SimdFloat4 y) {
+			__m128 low{ _mm_unpacklo_ps(x.value, y.value) };
+			__m128 high{ _mm_unpackhi_ps(x.value, y.value) };
+			_mm_storel_pi(reinterpret_cast<__m64*>(dest), low);
+			_mm_storeh_pi(reinterpret_cast<__m64*>(dest + stride), low);
+			_mm_storel_pi(reinterpret_cast<__m64*>(dest + 2 * stride), high);
+			_mm_storeh_pi(reinterpret_cast<__m64*>(dest + 3 * stride), high);
+		}
+
+		SimdFloat4 operator+(SimdFloat4 right) const {
+			return SimdFloat4{ _mm_add_ps(value, right.value) };
+		}
+
+		SimdFloat4 operator-(SimdFloat4 right) const {
+			return SimdFloat4{ _mm_sub_ps(value, right.value) };
+		}
+
+		SimdFloat4 operator*(SimdFloat4 right) const {
+			return SimdFloat4{ _mm_mul_ps(value, right.value) };
+		}
+
+		SimdFloat4 multiplyAdd(SimdFloat4 right, SimdFloat4 add) const {
+			return SimdFloat4{ Byte::multiplyAdd(value, right.value, add.value) };
+		}
+
+		template<typename Register>
+		static void deinterleave(Register first, Register second, Register third, Register& x, Register& y, Register& z) {
+			x = shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(first, shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(second, third));
+			y = shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(
+				shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(first, second),
+				shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(second, third));
+			z = shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(
+				shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(first, second),
+				shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(third, third));
+		}
+
+		template<typename Register>
+		static void interleave(Register x, Register y, Register z, Register& first, Register& second, Register& third) {
+			first = shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(unpackLow(x, y), shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(z, x));
+			second = shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(
+				shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(y, z),
+				shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(x, y));
+			third = shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(
+				shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(z, x),
+				shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(y, z));
+		}
+	};
+
+#ifdef BYTE_MATH_AVX2
+	struct SimdFloat8 {
+		inline static constexpr size_t WIDTH{ 8 };
+
+		__m256 value;
+
+		static SimdFloat8 broadcast(float value) {
+			return SimdFloat8{ _mm256_set1_ps(value) };
+		}
+
+		static SimdFloat8 load(const float* source) {
+			return SimdFloat8{ _mm256_loadu_ps(source) };
+		}
+
+		static SimdFloat8 gather(const float* source, size_t stride) {
+			__m256i indices{ _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(stride))) };
+			return SimdFloat8{ _mm256_i32gather_ps(source, indices, 4) };
+		}
+
+		static void loadPoints(const float* source, SimdFloat8& x, SimdFloat8& y, SimdFloat8& z) {
+			SimdFloat4::deinterleave(
+				load(source, source + 12),
+				load(source + 4, source + 16),
+				load(source + 8, source + 20),
+				x.value, y.value, z.value);
+		}
+
+		static void storePoints(float* dest, SimdFloat8 x, SimdFloat8 y, SimdFloat8 z) {
+			__m256 first, second, third;
+			SimdFloat4::interleave(x.value, y.value, z.value, first, second, third);
+			store(dest, dest + 12, first);
+			store(dest + 4, dest + 16, second);
+			store(dest + 8, dest + 20, third);
+		}
+
+		static void storeColumns(float* dest, size_t stride, SimdFloat8 x, SimdFloat8 y, SimdFloat8 z, SimdFloat8 w) {
+			SimdFloat4::storeColumns(dest, stride,
+				SimdFloat4{ _mm256_castps256_ps128(x.value) },
+				SimdFloat4{ _mm256_castps256_ps128(y.value) },
+				SimdFloat4{ _mm256_castps256_ps128(z.value) },
+				SimdFloat4{ _mm256_castps256_ps128(w.value) });
+			SimdFloat4::storeColumns(dest + 4 * stride, stride,
+				SimdFloat4{ _mm256_extractf128_ps(x.value, 1) },
+				SimdFloat4{ _mm256_extractf128_ps(y.value, 1) },
+				SimdFloat4{ _mm256_extractf128_ps(z.value, 1) },
+				SimdFloat4{ _mm256_extractf128_ps(w.value, 1) });
+		}
+
+		static void storeColumns(float* dest, size_t stride, SimdFloat8 x, SimdFloat8 y) {
+			SimdFloat4::storeColumns(dest, stride,
+				SimdFloat4{ _mm256_castps256_ps128(x.value) },
+				SimdFloat4{ _mm256_castps256_ps128(y.value) });
+			SimdFloat4::storeColumns(dest + 4 * stride, stride,
+				SimdFloat4{ _mm256_extractf128_ps(x.value, 1) },
+				SimdFloat4{ _mm256_extractf128_ps(y.value, 1) });
+		}
+
+		SimdFloat8 operator+(SimdFloat8 right) const {
+			return SimdFloat8{ _mm256_add_ps(value, right.value) };
+		}
+
+		SimdFloat8 operator-(SimdFloat8 right) const {
+			return SimdFloat8{ _mm256_sub_ps(value, right.value) };
+		}
+
+		SimdFloat8 operator*(SimdFloat8 right) const {
+			return SimdFloat8{ _mm256_mul_ps(value, right.value) };
+		}
+
+		SimdFloat8 multiplyAdd(SimdFloat8 right, SimdFloat8 add) const {
+			return SimdFloat8{ _mm256_fmadd_ps(value, right.value, add.value) };
+		}
+
+	private:
+		static __m256 load(const float* low, const float* high) {
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+		}
+
+		static void store(float* low, float* high, __m256 value) {
+			_mm_storeu_ps(low, _mm256_castps256_ps128(value));
+			_mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+		}
+	};
+
+	using SimdFloat = SimdFloat8;
+#else
+	using SimdFloat = SimdFloat4;
+#endif
+
+	inline void multiplyMat4(const float* left, const float* right, float* out) {
+		__m128 columns[4]{
+			_mm_load_ps(left),
+			_mm_load_ps(left + 4),
+			_mm_load_ps(left + 8),
+			_mm_load_ps(left + 12) };
+
+		for (size_t column{}; column < 4; ++column) {
+			const float* source{ right + column * 4 };
+			__m128 result{ _mm_mul_ps(columns[0], _mm_set1_ps(source[0])) };
+			result = multiplyAdd(columns[1], _mm_set1_ps(source[1]), result);
+			result = multiplyAdd(columns[2], _mm_set1_ps(source[2]), result);
+			result = multiplyAdd(columns[3], _mm_set1_ps(source[3]), result);
+			_mm_store_ps(out + column * 4, result);
+		}
+	}
+
+	inline void transformVec4(const float* mat, const float* vec, float* out) {
+		__m128 result{ _mm_mul_ps(_mm_load_ps(mat), _mm_set1_ps(vec[0])) };
+		result = multiplyAdd(_mm_load_ps(mat + 4), _mm_set1_ps(vec[1]), result);
+		result = multiplyAdd(_mm_load_ps(mat + 8), _mm_set1_ps(vec[2]), result);
+		result = multiplyAdd(_mm_load_ps(mat + 12), _mm_set1_ps(vec[3]), result);
+		_mm_storeu_ps(out, result);
+	}
+
+	inline __m128 multiplyMat2(__m128 left, __m128 right) {
+		return _mm_add_ps(
+			_mm_mul_ps(left, swizzle<_MM_SHUFFLE(3, 0, 3, 0)>(right)),
+			_mm_mul_ps(swizzle<_MM_SHUFFLE(2, 3, 0, 1)>(left), swizzle<_MM_SHUFFLE(1, 2, 1, 2)>(right)));
+	}
+
+	inline __m128 adjugateMultiplyMat2(__m128 left, __m128 right) {
+		return _mm_sub_ps(
+			_mm_mul_ps(swizzle<_MM_SHUFFLE(0, 0, 3, 3)>(left), right),
+			_mm_mul_ps(swizzle<_MM_SHUFFLE(2, 2, 1, 1)>(left), swizzle<_MM_SHUFFLE(1, 0, 3, 2)>(right)));
+	}
+
+	inline __m128 multiplyAdjugateMat2(__m128 left, __m128 right) {
+		return _mm_sub_ps(
+			_mm_mul_ps(left, swizzle<_MM_SHUFFLE(0, 3, 0, 3)>(right)),
+			_mm_mul_ps(swizzle<_MM_SHUFFLE(2, 3, 0, 1)>(left), swizzle<_MM_SHUFFLE(1, 2, 1, 2)>(right)));
+	}
+
+	inline bool inverseMat4(const float* source, float* out) {
+		__m128 first{ _mm_load_ps(source) };
+		__m128 second{ _mm_load_ps(source + 4) };
+		__m128 third{ _mm_load_ps(source + 8) };
+		__m128 fourth{ _mm_load_ps(source + 12) };
+
+		__m128 a{ _mm_movelh_ps(first, second) };
+		__m128 b{ _mm_movehl_ps(second, first) };
+		__m128 c{ _mm_movelh_ps(third, fourth) };
+		__m128 d{ _mm_movehl_ps(fourth, third) };
+
+		__m128 determinants{ _mm_sub_ps(
+			_mm_mul_ps(shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(first, third), shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(second, fourth)),
+			_mm_mul_ps(shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(first, third), shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(second, fourth))) };
+		__m128 detA{ swizzle<_MM_SHUFFLE(0, 0, 0, 0)>(determinants) };
+		__m128 detB{ swizzle<_MM_SHUFFLE(1, 1, 1, 1)>(determinants) };
+		__m128 detC{ swizzle<_MM_SHUFFLE(2, 2, 2, 2)>(determinants) };
+		__m128 detD{ swizzle<_MM_SHUFFLE(3, 3, 3, 3)>(determinants) };
+
+		__m128 dc{ adjugateMultiplyMat2(d, c) };
+		__m128 ab{ adjugateMultiplyMat2(a, b) };
+		__m128 x{ _mm_sub_ps(_mm_mul_ps(detD, a), multiplyMat2(b, dc)) };
+		__m128 w{ _mm_sub_ps(_mm_mul_ps(detA, d), multiplyMat2(c, ab)) };
+		__m128 y{ _mm_sub_ps(_mm_mul_ps(detB, c), multiplyAdjugateMat2(d, ab)) };
+		__m128 z{ _mm_sub_ps(_mm_mul_ps(detC, b), multiplyAdjugateMat2(a, dc)) };
+
+		__m128 trace{ _mm_mul_ps(ab, swizzle<_MM_SHUFFLE(3, 1, 2, 0)>(dc)) };
+		trace = _mm_add_ps(trace, swizzle<_MM_SHUFFLE(2, 3, 0, 1)>(trace));
+		trace = _mm_add_ps(trace, swizzle<_MM_SHUFFLE(1, 0, 3, 2)>(trace));
+
+		__m128 determinant{ _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace) };
+		if (_mm_cvtss_f32(determinant) == 0.0f) {
+			return false;
+		}
+
+		__m128 reciprocal{ _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant) };
+		x = _mm_mul_ps(x, reciprocal);
+		y = _mm_mul_ps(y, reciprocal);
+		z = _mm_mul_ps(z, reciprocal);
+		w = _mm_mul_ps(w, reciprocal);
+
+		_mm_store_ps(out, shuffle<_MM_SHUFFLE(1, 3, 1, 3)>(x, y));
+		_mm_store_ps(out + 4, shuffle<_MM_SHUFFLE(0, 2, 0, 2)>(x, y));
+		_mm_store_ps(out + 8, shuffle<_MM_SHUFFLE(1, 3, 1, 3)>(z, w));
+		_mm_store_ps(out + 12, shuffle<_MM_SHUFFLE(0, 2, 0, 2)>(z, w));
+		return true;
+	}
+#endif
+
+}
\ No newline at end of file
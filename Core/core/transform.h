@@ -1,5 +1,10 @@
 #pragma once
 
+#include <span>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
 #include "byte_math.h"
 
 namespace Byte {
@@ -10,10 +15,91 @@ namespace Byte {
 		Quaternion rotation{};
 	};
 
+	inline Mat4 composeTRS(const TransformData& data) {
+		const Quaternion& q{ data.rotation };
+		float xx{ q.x * q.x }, yy{ q.y * q.y }, zz{ q.z * q.z };
+		float xy{ q.x * q.y }, xz{ q.x * q.z }, yz{ q.y * q.z };
+		float wx{ q.w * q.x }, wy{ q.w * q.y }, wz{ q.w * q.z };
+
+		Mat4 out{ 0 };
+		out(0, 0) = (1.0f - 2.0f * (yy + zz)) * data.scale.x;
+		out(1, 0) = 2.0f * (xy + wz) * data.scale.x;
+		out(2, 0) = 2.0f * (xz - wy) * data.scale.x;
+		out(0, 1) = 2.0f * (xy - wz) * data.scale.y;
+		out(1, 1) = (1.0f - 2.0f * (xx + zz)) * data.scale.y;
+		out(2, 1) = 2.0f * (yz + wx) * data.scale.y;
+		out(0, 2) = 2.0f * (xz + wy) * data.scale.z;
+		out(1, 2) = 2.0f * (yz - wx) * data.scale.z;
+		out(2, 2) = (1.0f - 2.0f * (xx + yy)) * data.scale.z;
+		out(0, 3) = data.position.x;
+		out(1, 3) = data.position.y;
+		out(2, 3) = data.position.z;
+		out(3, 3) = 1.0f;
+		return out;
+	}
+
+#ifdef BYTE_MATH_SSE
+	template<typename Simd>
+	inline void composeTRS(
+		float* dest,
+		Simd px, Simd py, Simd pz,
+		Simd sx, Simd sy, Simd sz,
+		Simd qx, Simd qy, Simd qz, Simd qw) {
+		Simd zero{ Simd::broadcast(0.0f) };
+		Simd one{ Simd::broadcast(1.0f) };
+		Simd two{ Simd::broadcast(2.0f) };
+
+		Simd xx{ qx * qx }, yy{ qy * qy }, zz{ qz * qz };
+		Simd xy{ qx * qy }, xz{ qx * qz }, yz{ qy * qz };
+		Simd wx{ qw * qx }, wy{ qw * qy }, wz{ qw * qz };
+
+		Simd::storeColumns(dest, 16,
+			(one - two * (yy + zz)) * sx, two * (xy + wz) * sx, two * (xz - wy) * sx, zero);
+		Simd::storeColumns(dest + 4, 16,
+			two * (xy - wz) * sy, (one - two * (xx + zz)) * sy, two * (yz + wx) * sy, zero);
+		Simd::storeColumns(dest + 8, 16,
+			two * (xz + wy) * sz, two * (yz - wx) * sz, (one - two * (xx + yy)) * sz, zero);
+		Simd::storeColumns(dest + 12, 16, px, py, pz, one);
+	}
+#endif
+
+	inline void composeTRS(std::span<const TransformData> transforms, std::span<Mat4> out) {
+		static_assert(sizeof(TransformData) == 10 * sizeof(float), "Transforms are read as packed float records.");
+
+		size_t count{ std::min(transforms.size(), out.size()) };
+		size_t _index{};
+#ifdef BYTE_MATH_SSE
+		constexpr size_t STRIDE{ sizeof(TransformData) / sizeof(float) };
+
+		for (; _index + SimdFloat::WIDTH <= count; _index += SimdFloat::WIDTH) {
+			const float* source{ &transforms[_index].position.x };
+			composeTRS(out[_index].data,
+				SimdFloat::gather(source, STRIDE), SimdFloat::gather(source + 1, STRIDE), SimdFloat::gather(source + 2, STRIDE),
+				SimdFloat::gather(source + 3, STRIDE), SimdFloat::gather(source + 4, STRIDE), SimdFloat::gather(source + 5, STRIDE),
+				SimdFloat::gather(source + 7, STRIDE), SimdFloat::gather(source + 8, STRIDE), SimdFloat::gather(source + 9, STRIDE),
+				SimdFloat::gather(source + 6, STRIDE));
+		}
+#endif
+		for (; _index < count; ++_index) {
+			out[_index] = composeTRS(transforms[_index]);
+		}
+	}
+
 	class Transform {
 	private:
+		enum CacheBit : uint8_t {
+			MODEL = 1 << 0,
+			INVERSE_MODEL = 1 << 1,
+			LOCKED = 1 << 7
+		};
+
 		TransformData _local;
 		TransformData _global;
+		TransformData _parent;
+
+		mutable Mat4 _model;
+		mutable Mat4 _inverseModel;
+		mutable uint8_t _cached{};
 
 		bool _changed{ true };
 
@@ -31,25 +117,23 @@ namespace Byte {
 		}
 
 		void position(const Vec3& pos) {
-			Vec3 delta = pos - _global.position;
-			_local.position += delta;
 			_global.position = pos;
-			_changed = true;
+			_local.position = (_parent.rotation.conjugated() * (pos - _parent.position)) / _parent.scale;
+			invalidate();
 		}
 
 		void scale(const Vec3& scale) {
-			Vec3 ratio = scale / _global.scale;
-			_local.scale *= ratio;
 			_global.scale = scale;
-			_changed = true;
+			_local.scale = scale / _parent.scale;
+			invalidate();
 		}
 
 		void rotation(const Quaternion& rot) {
-			_local.rotation = rot;
 			_global.rotation = rot;
-			_local.rotation.normalize();
 			_global.rotation.normalize();
-			_changed = true;
+			_local.rotation = _parent.rotation.conjugated() * _global.rotation;
+			_local.rotation.normalize();
+			invalidate();
 		}
 
 		void rotation(const Vec3& euler) {
@@ -57,17 +141,46 @@ namespace Byte {
 		}
 
 		void rotate(const Quaternion& delta) {
-			_local.rotation = delta * _local.rotation;
-			_global.rotation = delta * _global.rotation;
-			_local.rotation.normalize();
-			_global.rotation.normalize();
-			_changed = true;
+			rotation(delta * _global.rotation);
 		}
 
 		void rotate(const Vec3& euler) {
 			rotate(Quaternion{ euler });
 		}
 
+		void localPosition(const Vec3& pos) {
+			_local.position = pos;
+			_changed = true;
+		}
+
+		void localScale(const Vec3& scale) {
+			_local.scale = scale;
+			_changed = true;
+		}
+
+		void localRotation(const Quaternion& rot) {
+			_local.rotation = rot;
+			_local.rotation.normalize();
+			_changed = true;
+		}
+
+		void propagate() {
+			_global = _local;
+			_parent = TransformData{};
+			reset();
+			_changed = false;
+		}
+
+		void propagate(const TransformData& parent) {
+			_global.scale = parent.scale * _local.scale;
+			_global.rotation = parent.rotation * _local.rotation;
+			_global.rotation.normalize();
+			_global.position = parent.position + parent.rotation * (parent.scale * _local.position);
+			_parent = parent;
+			reset();
+			_changed = false;
+		}
+
 		Vec3 front() const { 
 			return _global.rotation * Vec3{ 0, 0, -1 }; 
 		}
@@ -80,11 +193,19 @@ namespace Byte {
 			return _global.rotation * Vec3{ 1, 0, 0 }; 
 		}
 
-		Mat4 view() const {
-			Vec3 f = front().normalized();
-			Vec3 r = right().normalized();
-			Vec3 u = r.cross(f);
-			return Mat4::view(_global.position, _global.position + f, u);
+		const Mat4& model() const {
+			fill(MODEL, [this]() {
+				_model = composeTRS(_global);
+			});
+			return _model;
+		}
+
+		const Mat4& inverseModel() const {
+			const Mat4& matrix{ model() };
+			fill(INVERSE_MODEL, [this, &matrix]() {
+				_inverseModel = matrix.inverse();
+			});
+			return _inverseModel;
 		}
 
 		bool changed() const {
@@ -98,6 +219,31 @@ namespace Byte {
 		const TransformData& global() const {
 			return _global;
 		}
+
+	private:
+		void invalidate() {
+			reset();
+			_changed = true;
+		}
+
+		void reset() {
+			std::atomic_ref<uint8_t>{ _cached }.store(0, std::memory_order_relaxed);
+		}
+
+		template<typename Function>
+		void fill(uint8_t bit, Function&& function) const {
+			std::atomic_ref<uint8_t> cached{ _cached };
+			uint8_t state{ cached.load(std::memory_order_acquire) };
+
+			while (!(state & bit)) {
+				if (!(state & LOCKED) && cached.compare_exchange_weak(state, state | LOCKED, std::memory_order_acquire)) {
+					function();
+					cached.fetch_xor(static_cast<uint8_t>(bit | LOCKED), std::memory_order_release);
+					return;
+				}
+				state = cached.load(std::memory_order_acquire);
+			}
+		}
 	};
 
 }
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <span>
+#include <algorithm>
+
+#include "transform.h"
+
+namespace Byte {
+
+	class TransformStream {
+	public:
+		enum Channel : size_t {
+			POSITION_X,
+			POSITION_Y,
+			POSITION_Z,
+			SCALE_X,
+			SCALE_Y,
+			SCALE_Z,
+			ROTATION_X,
+			ROTATION_Y,
+			ROTATION_Z,
+			ROTATION_W,
+			CHANNEL_COUNT
+		};
+
+		inline static constexpr size_t INSTANCE_STRIDE{ CHANNEL_COUNT };
+
+		using ChannelArray = std::array<std::vector<float>, CHANNEL_COUNT>;
+
+	private:
+		ChannelArray _channels;
+
+	public:
+		size_t size() const {
+			return _channels[POSITION_X].size();
+		}
+
+		bool empty() const {
+			return _channels[POSITION_X].empty();
+		}
+
+		void reserve(size_t newCapacity) {
+			for (std::vector<float>& channel : _channels) {
+				channel.reserve(newCapacity);
+			}
+		}
+
+		void resize(size_t newSize) {
+			for (std::vector<float>& channel : _channels) {
+				channel.resize(newSize);
+			}
+		}
+
+		void clear() {
+			for (std::vector<float>& channel : _channels) {
+				channel.clear();
+			}
+		}
+
+		void push(const TransformData& data) {
+			resize(size() + 1);
+			set(size() - 1, data);
+		}
+
+		void push(const Transform& transform) {
+			push(transform.global());
+		}
+
+		void set(size_t _index, const TransformData& data) {
+			_channels[POSITION_X][_index] = data.position.x;
+			_channels[POSITION_Y][_index] = data.position.y;
+			_channels[POSITION_Z][_index] = data.position.z;
+			_channels[SCALE_X][_index] = data.scale.x;
+			_channels[SCALE_Y][_index] = data.scale.y;
+			_channels[SCALE_Z][_index] = data.scale.z;
+			_channels[ROTATION_X][_index] = data.rotation.x;
+			_channels[ROTATION_Y][_index] = data.rotation.y;
+			_channels[ROTATION_Z][_index] = data.rotation.z;
+			_channels[ROTATION_W][_index] = data.rotation.w;
+		}
+
+		TransformData get(size_t _index) const {
+			return TransformData{
+				Vec3{ _channels[POSITION_X][_index], _channels[POSITION_Y][_index], _channels[POSITION_Z][_index] },
+				Vec3{ _channels[SCALE_X][_index], _channels[SCALE_Y][_index], _channels[SCALE_Z][_index] },
+				Quaternion{
+					_channels[ROTATION_W][_index],
+					_channels[ROTATION_X][_index],
+					_channels[ROTATION_Y][_index],
+					_channels[ROTATION_Z][_index] } };
+		}
+
+		float* channel(Channel channel) {
+			return _channels[channel].data();
+		}
+
+		const float* channel(Channel channel) const {
+			return _channels[channel].data();
+		}
+
+		void pack(float* out) const {
+			size_t count{ size() };
+			size_t _index{};
+#ifdef BYTE_MATH_SSE
+			for (; _index + SimdFloat::WIDTH <= count; _index += SimdFloat::WIDTH) {
+				float* dest{ out + _index * INSTANCE_STRIDE };
+				SimdFloat::storeColumns(dest, INSTANCE_STRIDE,
+					load(POSITION_X, _index), load(POSITION_Y, _index), load(POSITION_Z, _index), load(SCALE_X, _index));
+				SimdFloat::storeColumns(dest + 4, INSTANCE_STRIDE,
+					load(SCALE_Y, _index), load(SCALE_Z, _index), load(ROTATION_X, _index), load(ROTATION_Y, _index));
+				SimdFloat::storeColumns(dest + 8, INSTANCE_STRIDE,
+					load(ROTATION_Z, _index), load(ROTATION_W, _index));
+			}
+#endif
+			for (; _index < count; ++_index) {
+				for (size_t channel{}; channel < CHANNEL_COUNT; ++channel) {
+					out[_index * INSTANCE_STRIDE + channel] = _channels[channel][_index];
+				}
+			}
+		}
+
+		void matrices(std::span<Mat4> out) const {
+			size_t count{ std::min(size(), out.size()) };
+			size_t _index{};
+#ifdef BYTE_MATH_SSE
+			for (; _index + SimdFloat::WIDTH <= count; _index += SimdFloat::WIDTH) {
+				composeTRS(out[_index].data,
+					load(POSITION_X, _index), load(POSITION_Y, _index), load(POSITION_Z, _index),
+					load(SCALE_X, _index), load(SCALE_Y, _index), load(SCALE_Z, _index),
+					load(ROTATION_X, _index), load(ROTATION_Y, _index), load(ROTATION_Z, _index), load(ROTATION_W, _index));
+			}
+#endif
+			for (; _index < count; ++_index) {
+				out[_index] = composeTRS(get(_index));
+			}
+		}
+
+	private:
+#ifdef BYTE_MATH_SSE
+		SimdFloat load(Channel channel, size_t _index) const {
+			return SimdFloat::load(_channels[channel].data() + _index);
+		}
+#endif
+
+	};
+
+}
\ No newline at end of file
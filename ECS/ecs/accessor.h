@@ -29,9 +29,13 @@ namespace Byte {
 
 		virtual void carryComponent(size_t _index, UAccessor<Container>& from) = 0;
 
-		virtual void swapComponents(size_t first, size_t second) = 0;
+		virtual void fillComponent(size_t _index, size_t count, const UAccessor<Container>& from) = 0;
 
-		virtual void popBack() = 0;
+		virtual void carryComponents(const size_t* indices, size_t count, UAccessor<Container>& from) = 0;
+
+		virtual void eraseComponents(const size_t* indices, size_t count) = 0;
+
+		virtual void eraseComponent(size_t _index) = 0;
 
 		virtual size_t size() const = 0;
 
@@ -39,6 +43,12 @@ namespace Byte {
 
 		virtual size_t capacity() const = 0;
 
+		virtual size_t bytes() const = 0;
+
+		virtual void trim() = 0;
+
+		virtual void detach() = 0;
+
 		virtual void clear() = 0;
 
 		virtual UAccessor<Container> clone() const = 0;
@@ -48,6 +58,11 @@ namespace Byte {
 			return *static_cast<Accessor<Component, Container>*>(this);
 		}
 
+		template<typename Component>
+		const Accessor<Component, Container>& receive() const {
+			return *static_cast<const Accessor<Component, Container>*>(this);
+		}
+
 	};
 
 	template <typename Component, template<typename> class Container>
@@ -56,7 +71,9 @@ namespace Byte {
 		using ComponentContainer = Container<Component>;
 
 	private:
-		ComponentContainer container;
+		using SharedContainer = std::shared_ptr<ComponentContainer>;
+
+		SharedContainer container{ std::make_shared<ComponentContainer>() };
 
 	public:
 		UAccessor<Container> copy() const override {
@@ -68,37 +85,82 @@ namespace Byte {
 		}
 
 		void copyComponent(size_t _index, const UAccessor<Container>& from) override {
-			Accessor* castedFrom{ static_cast<Accessor*>(from.get()) };
-			container.push_back(castedFrom->get(_index));
+			const Accessor* castedFrom{ static_cast<const Accessor*>(from.get()) };
+			write().push_back(castedFrom->get(_index));
 		}
 
 		void carryComponent(size_t _index, UAccessor<Container>& from) override {
 			Accessor* castedFrom{ static_cast<Accessor*>(from.get()) };
-			container.push_back(std::move(castedFrom->get(_index)));
+			write().push_back(std::move(castedFrom->get(_index)));
+		}
+
+		void fillComponent(size_t _index, size_t count, const UAccessor<Container>& from) override {
+			pushFill(static_cast<const Accessor*>(from.get())->get(_index), count);
+		}
+
+		void carryComponents(const size_t* indices, size_t count, UAccessor<Container>& from) override {
+			ComponentContainer& source{ static_cast<Accessor*>(from.get())->write() };
+			ComponentContainer& dest{ write() };
+			for (size_t _index{}; _index < count; ++_index) {
+				dest.push_back(std::move(source[indices[_index]]));
+			}
 		}
 
-		void swapComponents(size_t first, size_t second) override {
-			std::swap(container.at(first), container.at(second));
+		void eraseComponents(const size_t* indices, size_t count) override {
+			ComponentContainer& target{ write() };
+			size_t lastIndex{ target.size() };
+			for (size_t _index{}; _index < count; ++_index) {
+				--lastIndex;
+				if (indices[_index] != lastIndex) {
+					target[indices[_index]] = std::move(target[lastIndex]);
+				}
+			}
+			for (size_t _index{}; _index < count; ++_index) {
+				target.pop_back();
+			}
 		}
 
-		void popBack()  override {
-			container.pop_back();
+		void eraseComponent(size_t _index) override {
+			ComponentContainer& target{ write() };
+			if (_index != target.size() - 1) {
+				target[_index] = std::move(target.back());
+			}
+			target.pop_back();
 		}
 
 		size_t size() const override {
-			return container.size();
+			return container->size();
 		}
 
 		void reserve(size_t newCapacity) override {
-			container.reserve(newCapacity);
+			write().reserve(newCapacity);
 		}
 
 		size_t capacity() const override {
-			return container.capacity();
+			return container->capacity();
+		}
+
+		size_t bytes() const override {
+			return container->capacity() * sizeof(Component);
+		}
+
+		void trim() override {
+			if (!shared() && container->size() < container->capacity() / 2) {
+				container->shrink_to_fit();
+			}
+		}
+
+		void detach() override {
+			write();
 		}
 
 		void clear() override {
-			container.clear();
+			if (shared()) {
+				container = std::make_shared<ComponentContainer>();
+			}
+			else {
+				container->clear();
+			}
 		}
 
 		UAccessor<Container> clone() const override {
@@ -106,21 +168,51 @@ namespace Byte {
 		}
 
 		Component& get(size_t _index) {
-			return container.at(_index);
+			return write()[_index];
 		}
 
 		const Component& get(size_t _index) const {
-			return container.at(_index);
+			return (*container)[_index];
 		}
 
-		template<typename Component>
-		void pushBack(Component&& component) {
-			container.push_back(std::forward<Component>(component));
+		Component* data() {
+			return write().data();
+		}
+
+		const Component* data() const {
+			return container->data();
+		}
+
+		template<typename _Component>
+		void pushBack(_Component&& component) {
+			write().push_back(std::forward<_Component>(component));
 		}
 		
 		template<typename... Args>
 		void emplaceBack(Args&&... args) {
-			container.emplace_back(std::forward<Args>(args)...);
+			write().emplace_back(std::forward<Args>(args)...);
+		}
+
+		void pushFill(const Component& component, size_t count) {
+			ComponentContainer& target{ write() };
+			target.insert(target.end(), count, component);
+		}
+
+		void pushRange(const Component* components, size_t count) {
+			ComponentContainer& target{ write() };
+			target.insert(target.end(), components, components + count);
+		}
+
+		bool shared() const {
+			return container.use_count() > 1;
+		}
+
+	private:
+		ComponentContainer& write() {
+			if (shared()) {
+				container = std::make_shared<ComponentContainer>(*container);
+			}
+			return *container;
 		}
  
 	};
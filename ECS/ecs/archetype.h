@@ -2,8 +2,11 @@
 
 #include <unordered_map>
 #include <vector>
+#include <array>
+#include <utility>
 #include <type_traits>
 #include <tuple>
+#include <algorithm>
 #include <iostream>
 
 #include "accessor.h"
@@ -12,26 +15,48 @@
 
 namespace Byte {
 
+	template<typename Archetype>
+	struct ArchetypeEdge {
+		Archetype* add{ nullptr };
+		Archetype* remove{ nullptr };
+	};
+
+	struct ColumnMemory {
+		ComponentID component{};
+		size_t bytes{};
+	};
+
+	using ColumnMemoryVector = std::vector<ColumnMemory>;
+
 	template<
 		typename _EntityID, 
 		template<typename> class _Container,
-		size_t _MAX_COMPONENT_COUNT>
+		size_t _MAX_COMPONENT_COUNT,
+		typename _ComponentList = ComponentList<>>
 	class Archetype {
 	public:
 		inline static constexpr size_t MAX_COMPONENT_COUNT{ _MAX_COMPONENT_COUNT };
+		inline static constexpr size_t CHUNK_CAPACITY{ 4096 };
 		
 		using EntityID = _EntityID;
 		template<typename Component>
 		using Container = _Container<Component>;
 		template<typename Component>
-		using Accessor = Accessor<Component, Container>;
-		using UAccessor = UAccessor<Container>;
+		using Accessor = Byte::Accessor<Component, Container>;
+		using UAccessor = Byte::UAccessor<Container>;
 		using AccessorMap = std::unordered_map<ComponentID, UAccessor>;
-		using Signature = Signature<MAX_COMPONENT_COUNT>;
+		using ComponentList = _ComponentList;
+		using Signature = Byte::Signature<MAX_COMPONENT_COUNT, ComponentList>;
+		using Edge = ArchetypeEdge<Archetype>;
+		using EdgeVector = std::vector<Edge>;
+		using VersionVector = std::vector<uint64_t>;
+		using VersionMap = std::unordered_map<ComponentID, VersionVector>;
 		
 	private:
 		AccessorMap _accessors;
+		VersionMap _versions;
 		Signature _signature;
+		EdgeVector _edges;
 
 	public:
 		Archetype() {
@@ -53,37 +78,65 @@ namespace Byte {
 
 		~Archetype() = default;
 
-		const Signature& signature() {
+		const Signature& signature() const {
 			return _signature;
 		}
 
+		template<typename Component>
+		static ComponentID componentID() {
+			return ComponentList::template id<std::decay_t<Component>>();
+		}
+
+		Edge& edge(ComponentID id) {
+			if (id >= _edges.size()) {
+				_edges.resize(id + 1);
+			}
+			return _edges[id];
+		}
+
+		void forget(const Archetype* arche) {
+			for (Edge& edge : _edges) {
+				if (edge.add == arche) {
+					edge.add = nullptr;
+				}
+				if (edge.remove == arche) {
+					edge.remove = nullptr;
+				}
+			}
+		}
+
 		size_t pushEntity(EntityID id) {
 			pushComponent(id);
-			return size() - 1;
+
+			size_t _index{ size() - 1 };
+			if (_index % CHUNK_CAPACITY == 0) {
+				fitVersions();
+			}
+			return _index;
 		}
 
 		template<typename Component>
 		void pushComponent(Component&& component) {
-			_accessors[Registry<std::decay_t<Component>>::id()]
-				->receive<std::decay_t<Component>>().pushBack(std::forward<Component>(component));
+			_accessors[componentID<Component>()]
+				->template receive<std::decay_t<Component>>().pushBack(std::forward<Component>(component));
 		}
 
 		template<typename Component, typename... Args>
 		void emplaceComponent(Args&&... args) {
-			_accessors[Registry<std::decay_t<Component>>::id()]
-				->receive<std::decay_t<Component>>().emplaceBack(std::forward<Args>(args)...);
+			_accessors[componentID<Component>()]
+				->template receive<std::decay_t<Component>>().emplaceBack(std::forward<Args>(args)...);
 		}
 
 		template<typename Component>
 		Component& getComponent(size_t _index) {
-			return _accessors[Registry<std::decay_t<Component>>::id()]
-				->receive<std::decay_t<Component>>().get(_index);
+			return _accessors[componentID<Component>()]
+				->template receive<std::decay_t<Component>>().get(_index);
 		}
 
 		template<typename Component>
 		const Component& getComponent(size_t _index) const {
-			return _accessors[Registry<std::decay_t<Component>>::id()]
-				->receive<std::decay_t<Component>>().get(_index);
+			const IAccessor<Container>& accessor{ *_accessors.at(componentID<Component>()) };
+			return accessor.template receive<std::decay_t<Component>>().get(_index);
 		}
 
 		EntityID erase(size_t _index) {
@@ -92,8 +145,7 @@ namespace Byte {
 			EntityID out{ getComponent<EntityID>(lastIndex) };
 
 			for (auto& pair : _accessors) {
-				pair.second->swapComponents(_index, lastIndex);
-				pair.second->popBack();
+				pair.second->eraseComponent(_index);
 			}
 
 			return out;
@@ -103,18 +155,72 @@ namespace Byte {
 			pushEntity(id);
 			for (auto& pair : from._accessors) {
 				auto accessor{ _accessors.find(pair.first) };
-				if (accessor != _accessors.end()) {
+				if (pair.first != componentID<EntityID>() && accessor != _accessors.end()) {
 					accessor->second->carryComponent(_index, pair.second);
 				}
 			}
 			return size() - 1;
 		}
 
+		size_t pushEntities(const EntityID* ids, size_t count) {
+			size_t first{ size() };
+			grow(first + count);
+
+			Accessor<EntityID>& entities{ _accessors.at(componentID<EntityID>())->template receive<EntityID>() };
+			for (size_t _index{}; _index < count; ++_index) {
+				entities.pushBack(ids[_index]);
+			}
+			fitVersions();
+
+			return first;
+		}
+
+		size_t carryEntities(const EntityID* ids, const size_t* indices, size_t count, Archetype& from) {
+			size_t first{ pushEntities(ids, count) };
+			for (auto& pair : from._accessors) {
+				auto accessor{ _accessors.find(pair.first) };
+				if (pair.first != componentID<EntityID>() && accessor != _accessors.end()) {
+					accessor->second->carryComponents(indices, count, pair.second);
+				}
+			}
+			return first;
+		}
+
+		void eraseEntities(const size_t* indices, size_t count) {
+			for (auto& pair : _accessors) {
+				pair.second->eraseComponents(indices, count);
+			}
+		}
+
+		template<typename Component>
+		void placeComponent(size_t, Component&& component) {
+			pushComponent(std::forward<Component>(component));
+		}
+
+		template<typename Component>
+		void fillComponents(size_t, const Component& component, size_t count) {
+			_accessors.at(componentID<Component>())->template receive<Component>().pushFill(component, count);
+		}
+
+		template<typename Component>
+		void placeComponents(size_t, const Component* components, size_t count) {
+			_accessors.at(componentID<Component>())->template receive<Component>().pushRange(components, count);
+		}
+
+		void fillRows(size_t first, size_t count, const Archetype& from, size_t _index) {
+			for (auto& pair : from._accessors) {
+				auto accessor{ _accessors.find(pair.first) };
+				if (pair.first != componentID<EntityID>() && accessor != _accessors.end()) {
+					accessor->second->fillComponent(_index, count, pair.second);
+				}
+			}
+		}
+
 		size_t copyEntity(size_t _index, EntityID id, const Archetype& from) {
 			pushEntity(id);
 			for (auto& pair : from._accessors) {
 				auto accessor{ _accessors.find(pair.first) };
-				if (accessor != _accessors.end()) {
+				if (pair.first != componentID<EntityID>() && accessor != _accessors.end()) {
 					accessor->second->copyComponent(_index, pair.second);
 				}
 			}
@@ -122,20 +228,76 @@ namespace Byte {
 		}
 
 		size_t size() const {
-			return _accessors.at(Registry<EntityID>::id())->size();
+			return _accessors.at(componentID<EntityID>())->size();
 		}
 
 		bool empty() const {
-			return _accessors.at(Registry<EntityID>::id())->size() == 0;
+			return _accessors.at(componentID<EntityID>())->size() == 0;
+		}
+
+		size_t capacity() const {
+			return _accessors.at(componentID<EntityID>())->capacity();
+		}
+
+		size_t chunkCapacity() const {
+			return CHUNK_CAPACITY;
+		}
+
+		size_t chunkCount() const {
+			return (size() + CHUNK_CAPACITY - 1) / CHUNK_CAPACITY;
+		}
+
+		size_t chunkSize(size_t chunk) const {
+			return std::min(CHUNK_CAPACITY, size() - chunk * CHUNK_CAPACITY);
+		}
+
+		void touch(ComponentID component, size_t chunk, uint64_t tick) {
+			auto result{ _versions.find(component) };
+			if (result != _versions.end() && chunk < result->second.size()) {
+				result->second[chunk] = tick;
+			}
+		}
+
+		void touchRows(size_t first, size_t count, uint64_t tick) {
+			if (count == 0) {
+				return;
+			}
+
+			size_t lastChunk{ (first + count - 1) / CHUNK_CAPACITY };
+			fitVersions();
+			for (auto& pair : _versions) {
+				std::fill(pair.second.begin() + first / CHUNK_CAPACITY, pair.second.begin() + lastChunk + 1, tick);
+			}
+		}
+
+		uint64_t version(ComponentID component, size_t chunk) const {
+			auto result{ _versions.find(component) };
+			if (result == _versions.end() || chunk >= result->second.size()) {
+				return 0;
+			}
+			return result->second[chunk];
+		}
+
+		template<typename Component>
+		Component* chunkData(size_t chunk) {
+			if constexpr (std::is_const_v<Component>) {
+				const IAccessor<Container>& accessor{ *_accessors.at(componentID<Component>()) };
+				return accessor.template receive<std::decay_t<Component>>().data() + chunk * CHUNK_CAPACITY;
+			}
+			else {
+				return _accessors.at(componentID<Component>())
+					->template receive<Component>().data() + chunk * CHUNK_CAPACITY;
+			}
 		}
 
 		Archetype copy() const {
 			Archetype out;
 
 			out._signature = _signature;
+			out._versions = _versions;
 
 			for (auto& pair : _accessors) {
-				out._accessors.emplace(pair.first, pair.second->copy());
+				out._accessors[pair.first] = pair.second->copy();
 			}
 
 			return out;
@@ -150,12 +312,13 @@ namespace Byte {
 		template<typename Component>
 		void emplaceAccessor() {
 			_accessors.emplace(
-				Registry<std::decay_t<Component>>::id(), std::make_unique<Accessor<std::decay_t<Component>>>());
-			_signature.set(Registry<std::decay_t<Component>>::id());
+				componentID<Component>(), std::make_unique<Accessor<std::decay_t<Component>>>());
+			_signature.set(componentID<Component>());
 		}
 
 		void eraseAccessor(ComponentID id) {
 			_accessors.erase(id);
+			_versions.erase(id);
 			_signature.set(id, false);
 		}
 
@@ -165,6 +328,30 @@ namespace Byte {
 			}
 		}
 
+		void trim() {
+			for (auto& pair : _accessors) {
+				pair.second->trim();
+			}
+		}
+
+		ColumnMemoryVector memory() const {
+			ColumnMemoryVector out;
+			for (auto& pair : _accessors) {
+				out.push_back(ColumnMemory{ pair.first, pair.second->bytes() });
+			}
+			std::sort(out.begin(), out.end(), [](const ColumnMemory& left, const ColumnMemory& right) {
+				return left.component < right.component;
+			});
+			return out;
+		}
+
+		void grow(size_t newSize) {
+			size_t capacity{ _accessors.at(componentID<EntityID>())->capacity() };
+			if (capacity < newSize) {
+				reserve(std::max(newSize, capacity * 2));
+			}
+		}
+
 		template<typename... Components>
 		static Archetype build() {
 			Archetype out;
@@ -197,38 +384,41 @@ namespace Byte {
 			return out;
 		}
 
+		void detachChunks() {
+			for (auto& pair : _accessors) {
+				pair.second->detach();
+			}
+		}
+
 		template<typename... Components>
 		class Cache {
 		public:
 			using ComponentGroup = std::tuple<Components&...>;
-			using AccessorVector = std::vector<IAccessor<Container>*>;
+			using DataTuple = std::tuple<Components*...>;
 
 		private:
-			AccessorVector _accessors;
+			DataTuple _data{};
+			size_t _size{};
 
 		public:
 			Cache() = default;
 
-			Cache(Archetype& arche) {
-				((_accessors.push_back(arche._accessors.at(Registry<Components>::id()).get())), ...);
+			Cache(Archetype& arche)
+				: _data{ arche.template chunkData<Components>(0)... }, _size{ arche.size() } {
 			}
 
 			ComponentGroup group(size_t _index) {
-				size_t iterator{ this->_accessors.size() };
-				return ComponentGroup(this->get<Components>(_index, --iterator)...);
+				return group(_index, std::index_sequence_for<Components...>{});
 			}
 
 			size_t size() const {
-				if (_accessors.empty()) {
-					return 0;
-				}
-				return _accessors[0]->size();
+				return _size;
 			}
 
 		private:
-			template<typename Component>
-			Component& get(size_t _index, size_t accessorIndex) {
-				return static_cast<Accessor<Component>*>(_accessors[accessorIndex])->get(_index);
+			template<size_t... Indices>
+			ComponentGroup group(size_t _index, std::index_sequence<Indices...>) {
+				return ComponentGroup(std::get<Indices>(_data)[_index]...);
 			}
 
 		};
@@ -238,6 +428,17 @@ namespace Byte {
 			return Cache<Components...>(*this);
 		}
 
+	private:
+		void fitVersions() {
+			size_t chunks{ chunkCount() };
+			for (auto& pair : _accessors) {
+				VersionVector& versions{ _versions[pair.first] };
+				if (versions.size() < chunks) {
+					versions.resize(chunks);
+				}
+			}
+		}
+
 	};
 
 }
\ No newline at end of file
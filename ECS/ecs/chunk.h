@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+
+namespace Byte {
+
+	template<typename Component>
+	struct chunk_storage;
+
+	class Chunk {
+	public:
+		inline static constexpr size_t SIZE{ 16 * 1024 };
+		inline static constexpr size_t ALIGNMENT{ 64 };
+
+	private:
+		struct Deleter {
+			void operator()(std::byte* data) const {
+				::operator delete[](data, std::align_val_t{ ALIGNMENT });
+			}
+		};
+
+		std::shared_ptr<std::byte> _data;
+		size_t _bytes{};
+		bool _borrowed{ false };
+
+	public:
+		Chunk(size_t bytes = SIZE)
+			: _data{ static_cast<std::byte*>(::operator new[](bytes, std::align_val_t{ ALIGNMENT })), Deleter{} },
+			_bytes{ bytes } {
+		}
+
+		Chunk(std::shared_ptr<std::byte> data, size_t bytes)
+			: _data{ std::move(data) }, _bytes{ bytes }, _borrowed{ true } {
+		}
+
+		std::byte* data() {
+			return _data.get();
+		}
+
+		const std::byte* data() const {
+			return _data.get();
+		}
+
+		size_t bytes() const {
+			return _bytes;
+		}
+
+		bool shared() const {
+			return _borrowed || _data.use_count() > 1;
+		}
+
+		static size_t align(size_t offset, size_t alignment) {
+			return (offset + alignment - 1) / alignment * alignment;
+		}
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,729 @@
+#pragma once
+
+#include <cstring>
+#include <vector>
+#include <array>
+#include <tuple>
+#include <limits>
+#include <utility>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+
+#include "archetype.h"
+#include "chunk.h"
+#include "component.h"
+#include "signature.h"
+
+namespace Byte {
+
+	template<typename _EntityID, size_t _MAX_COMPONENT_COUNT, typename _ComponentList>
+	class Archetype<_EntityID, chunk_storage, _MAX_COMPONENT_COUNT, _ComponentList> {
+	public:
+		inline static constexpr size_t MAX_COMPONENT_COUNT{ _MAX_COMPONENT_COUNT };
+
+		using EntityID = _EntityID;
+		template<typename Component>
+		using Container = chunk_storage<Component>;
+		using ComponentList = _ComponentList;
+		using Signature = Byte::Signature<MAX_COMPONENT_COUNT, ComponentList>;
+
+		struct Column {
+			ComponentID id{};
+			const ComponentInfo* info{ nullptr };
+			size_t offset{};
+		};
+
+		struct Run {
+			size_t target{};
+			size_t source{};
+			size_t count{};
+		};
+
+		using ColumnVector = std::vector<Column>;
+		using ColumnIndexVector = std::vector<uint16_t>;
+		using ChunkVector = std::vector<Chunk>;
+		using VersionVector = std::vector<uint64_t>;
+		using Edge = ArchetypeEdge<Archetype>;
+		using EdgeVector = std::vector<Edge>;
+		using RunVector = std::vector<Run>;
+
+	private:
+		inline static constexpr uint16_t NO_COLUMN{ std::numeric_limits<uint16_t>::max() };
+
+		ColumnVector _columns;
+		ColumnIndexVector _columnIndices;
+		ChunkVector _chunks;
+		VersionVector _versions;
+		Signature _signature;
+		EdgeVector _edges;
+
+		size_t _size{};
+		size_t _chunkCapacity{ 1 };
+		size_t _chunkBytes{ Chunk::SIZE };
+
+	public:
+		Archetype()
+			: _columnIndices(MAX_COMPONENT_COUNT, NO_COLUMN) {
+			emplaceAccessor<EntityID>();
+		}
+
+		Archetype(const Archetype& left)
+			: Archetype{ left.copy() } {
+		}
+
+		Archetype(Archetype&& right) noexcept
+			: _columns{ std::move(right._columns) },
+			_columnIndices{ std::move(right._columnIndices) },
+			_chunks{ std::move(right._chunks) },
+			_versions{ std::move(right._versions) },
+			_signature{ right._signature },
+			_edges{ std::move(right._edges) },
+			_size{ std::exchange(right._size, 0) },
+			_chunkCapacity{ right._chunkCapacity },
+			_chunkBytes{ right._chunkBytes } {
+		}
+
+		Archetype& operator=(const Archetype& left) {
+			*this = left.copy();
+			return *this;
+		}
+
+		Archetype& operator=(Archetype&& right) noexcept {
+			if (this != &right) {
+				clear();
+				_columns = std::move(right._columns);
+				_columnIndices = std::move(right._columnIndices);
+				_chunks = std::move(right._chunks);
+				_versions = std::move(right._versions);
+				_signature = right._signature;
+				_edges = std::move(right._edges);
+				_size = std::exchange(right._size, 0);
+				_chunkCapacity = right._chunkCapacity;
+				_chunkBytes = right._chunkBytes;
+			}
+			return *this;
+		}
+
+		~Archetype() {
+			clear();
+		}
+
+		const Signature& signature() const {
+			return _signature;
+		}
+
+		template<typename Component>
+		static ComponentID componentID() {
+			return ComponentList::template id<std::decay_t<Component>>();
+		}
+
+		Edge& edge(ComponentID id) {
+			if (id >= _edges.size()) {
+				_edges.resize(id + 1);
+			}
+			return _edges[id];
+		}
+
+		void forget(const Archetype* arche) {
+			for (Edge& edge : _edges) {
+				if (edge.add == arche) {
+					edge.add = nullptr;
+				}
+				if (edge.remove == arche) {
+					edge.remove = nullptr;
+				}
+			}
+		}
+
+		size_t pushEntity(EntityID id) {
+			if (_size == capacity()) {
+				_chunks.emplace_back(_chunkBytes);
+				fitVersions();
+			}
+			else {
+				detach(_size / _chunkCapacity);
+			}
+
+			size_t _index{ _size++ };
+			new (address(column(componentID<EntityID>()), _index)) EntityID(id);
+			return _index;
+		}
+
+		template<typename Component>
+		void pushComponent(Component&& component) {
+			using Type = std::decay_t<Component>;
+			new (address(column(componentID<Type>()), _size - 1)) Type(std::forward<Component>(component));
+		}
+
+		template<typename Component, typename... Args>
+		void emplaceComponent(Args&&... args) {
+			using Type = std::decay_t<Component>;
+			new (address(column(componentID<Type>()), _size - 1)) Type(std::forward<Args>(args)...);
+		}
+
+		template<typename Component>
+		Component& getComponent(size_t _index) {
+			using Type = std::decay_t<Component>;
+			detach(_index / _chunkCapacity);
+			return *reinterpret_cast<Type*>(address(column(componentID<Type>()), _index));
+		}
+
+		template<typename Component>
+		const Component& getComponent(size_t _index) const {
+			using Type = std::decay_t<Component>;
+			return *reinterpret_cast<const Type*>(address(column(componentID<Type>()), _index));
+		}
+
+		EntityID erase(size_t _index) {
+			size_t lastIndex{ _size - 1 };
+
+			detach(_index / _chunkCapacity);
+			detach(lastIndex / _chunkCapacity);
+			EntityID out{ getComponent<EntityID>(lastIndex) };
+
+			for (const Column& column : _columns) {
+				std::byte* target{ address(column, _index) };
+				destroyRows(column, target, 1);
+
+				if (_index != lastIndex) {
+					relocateRows(column, target, address(column, lastIndex), 1);
+				}
+			}
+
+			--_size;
+			releaseChunks();
+
+			return out;
+		}
+
+		size_t carryEntity(size_t _index, EntityID id, Archetype& from) {
+			size_t newIndex{ pushEntity(id) };
+			from.detach(_index / from._chunkCapacity);
+			for (const Column& column : from._columns) {
+				if (column.id != componentID<EntityID>() && _columnIndices[column.id] != NO_COLUMN) {
+					moveRows(column, address(_columns[_columnIndices[column.id]], newIndex), from.address(column, _index), 1);
+				}
+			}
+			return newIndex;
+		}
+
+		size_t pushEntities(const EntityID* ids, size_t count) {
+			size_t first{ _size };
+			reserve(first + count);
+			detachRows(first, count);
+
+			const Column& entities{ column(componentID<EntityID>()) };
+			for (size_t _index{}; _index < count; ++_index) {
+				new (address(entities, first + _index)) EntityID(ids[_index]);
+			}
+			_size += count;
+
+			return first;
+		}
+
+		size_t carryEntities(const EntityID* ids, const size_t* indices, size_t count, Archetype& from) {
+			size_t first{ pushEntities(ids, count) };
+			RunVector runs;
+			for (size_t _index{}; _index < count; ++_index) {
+				from.detach(indices[_index] / from._chunkCapacity);
+				pushRun(runs, first + _index, indices[_index], _chunkCapacity, from._chunkCapacity);
+			}
+
+			for (const Column& column : from._columns) {
+				if (column.id != componentID<EntityID>() && _columnIndices[column.id] != NO_COLUMN) {
+					const Column& dest{ _columns[_columnIndices[column.id]] };
+					for (const Run& run : runs) {
+						moveRows(column, address(dest, run.target), from.address(column, run.source), run.count);
+					}
+				}
+			}
+			return first;
+		}
+
+		void eraseEntities(const size_t* indices, size_t count) {
+			size_t newSize{ _size - count };
+			for (size_t _index{}; _index < count; ++_index) {
+				detach(indices[_index] / _chunkCapacity);
+			}
+			detachRows(newSize, count);
+
+			size_t tail{};
+			while (tail < count && indices[tail] >= newSize) {
+				++tail;
+			}
+
+			RunVector erased;
+			for (size_t _index{ count }; _index > 0; --_index) {
+				pushRun(erased, indices[_index - 1], indices[_index - 1], _chunkCapacity, _chunkCapacity);
+			}
+
+			RunVector moves;
+			size_t hole{ count };
+			for (size_t row{ newSize }; row < _size; ++row) {
+				if (tail > 0 && indices[tail - 1] == row) {
+					--tail;
+					continue;
+				}
+				--hole;
+				pushRun(moves, indices[hole], row, _chunkCapacity, _chunkCapacity);
+			}
+
+			for (const Column& column : _columns) {
+				for (const Run& run : erased) {
+					destroyRows(column, address(column, run.target), run.count);
+				}
+				for (const Run& run : moves) {
+					relocateRows(column, address(column, run.target), address(column, run.source), run.count);
+				}
+			}
+
+			_size = newSize;
+			releaseChunks();
+		}
+
+		template<typename Component>
+		void placeComponent(size_t _index, Component&& component) {
+			using Type = std::decay_t<Component>;
+			new (address(column(componentID<Type>()), _index)) Type(std::forward<Component>(component));
+		}
+
+		template<typename Component>
+		void fillComponents(size_t first, const Component& component, size_t count) {
+			const Column& target{ column(componentID<Component>()) };
+			for (size_t done{}; done < count;) {
+				size_t _index{ first + done };
+				size_t run{ std::min(count - done, _chunkCapacity - _index % _chunkCapacity) };
+				std::uninitialized_fill_n(reinterpret_cast<Component*>(address(target, _index)), run, component);
+				done += run;
+			}
+		}
+
+		template<typename Component>
+		void placeComponents(size_t first, const Component* components, size_t count) {
+			const Column& target{ column(componentID<Component>()) };
+			for (size_t done{}; done < count;) {
+				size_t _index{ first + done };
+				size_t run{ std::min(count - done, _chunkCapacity - _index % _chunkCapacity) };
+				std::uninitialized_copy_n(components + done, run, reinterpret_cast<Component*>(address(target, _index)));
+				done += run;
+			}
+		}
+
+		void fillRows(size_t first, size_t count, const Archetype& from, size_t _index) {
+			for (const Column& source : from._columns) {
+				if (source.id == componentID<EntityID>() || _columnIndices[source.id] == NO_COLUMN) {
+					continue;
+				}
+
+				const Column& target{ column(source.id) };
+				for (size_t done{}; done < count;) {
+					size_t row{ first + done };
+					size_t run{ std::min(count - done, _chunkCapacity - row % _chunkCapacity) };
+					target.info->fillConstruct(address(target, row), from.address(source, _index), run);
+					done += run;
+				}
+			}
+		}
+
+		size_t copyEntity(size_t _index, EntityID id, const Archetype& from) {
+			size_t newIndex{ pushEntity(id) };
+			for (const Column& column : from._columns) {
+				if (column.id != componentID<EntityID>() && _columnIndices[column.id] != NO_COLUMN) {
+					copyRows(column, address(_columns[_columnIndices[column.id]], newIndex), from.address(column, _index), 1);
+				}
+			}
+			return newIndex;
+		}
+
+		size_t size() const {
+			return _size;
+		}
+
+		bool empty() const {
+			return _size == 0;
+		}
+
+		size_t capacity() const {
+			return _chunks.size() * _chunkCapacity;
+		}
+
+		size_t chunkCapacity() const {
+			return _chunkCapacity;
+		}
+
+		size_t chunkBytes() const {
+			return _chunkBytes;
+		}
+
+		size_t columnOffset(ComponentID id) const {
+			return column(id).offset;
+		}
+
+		size_t chunkCount() const {
+			return (_size + _chunkCapacity - 1) / _chunkCapacity;
+		}
+
+		size_t chunkSize(size_t chunk) const {
+			return std::min(_chunkCapacity, _size - chunk * _chunkCapacity);
+		}
+
+		void touch(ComponentID component, size_t chunk, uint64_t tick) {
+			if (_columnIndices[component] == NO_COLUMN) {
+				return;
+			}
+
+			_versions[chunk * _columns.size() + _columnIndices[component]] = tick;
+		}
+
+		void touchRows(size_t first, size_t count, uint64_t tick) {
+			if (count == 0) {
+				return;
+			}
+
+			size_t lastChunk{ (first + count - 1) / _chunkCapacity };
+			for (size_t chunk{ first / _chunkCapacity }; chunk <= lastChunk; ++chunk) {
+				std::fill_n(_versions.begin() + chunk * _columns.size(), _columns.size(), tick);
+			}
+		}
+
+		uint64_t version(ComponentID component, size_t chunk) const {
+			if (_columnIndices[component] == NO_COLUMN) {
+				return 0;
+			}
+
+			size_t _index{ chunk * _columns.size() + _columnIndices[component] };
+			return _index < _versions.size() ? _versions[_index] : 0;
+		}
+
+		template<typename Component>
+		Component* chunkData(size_t chunk) {
+			if constexpr (!std::is_const_v<Component>) {
+				detach(chunk);
+			}
+
+			const Column& target{ column(componentID<Component>()) };
+			return reinterpret_cast<Component*>(_chunks[chunk].data() + target.offset);
+		}
+
+		Archetype copy() const {
+			Archetype out;
+
+			out._columns = _columns;
+			out._columnIndices = _columnIndices;
+			out._versions = _versions;
+			out._signature = _signature;
+			out._chunkCapacity = _chunkCapacity;
+			out._chunkBytes = _chunkBytes;
+
+			out._chunks = _chunks;
+			out._size = _size;
+
+			return out;
+		}
+
+		void clear() {
+			for (size_t chunk{}; chunk < chunkCount(); ++chunk) {
+				if (_chunks[chunk].shared()) {
+					continue;
+				}
+
+				for (const Column& column : _columns) {
+					destroyRows(column, address(column, chunk * _chunkCapacity), chunkSize(chunk));
+				}
+			}
+
+			std::erase_if(_chunks, [](const Chunk& chunk) {
+				return chunk.shared();
+			});
+			fitVersions();
+			_size = 0;
+		}
+
+		void adoptChunks(ChunkVector&& chunks, size_t size) {
+			clear();
+			_chunks = std::move(chunks);
+			fitVersions();
+			_size = size;
+		}
+
+		void detachChunks() {
+			for (size_t chunk{}; chunk < _chunks.size(); ++chunk) {
+				detach(chunk);
+			}
+		}
+
+		template<typename Component>
+		void emplaceAccessor() {
+			using Type = std::decay_t<Component>;
+			emplaceColumn(componentID<Type>(), &Registry<Type>::info());
+			relayout();
+		}
+
+		void eraseAccessor(ComponentID id) {
+			if (_columnIndices[id] != NO_COLUMN) {
+				_columns.erase(_columns.begin() + _columnIndices[id]);
+				_signature.set(id, false);
+				relayout();
+			}
+		}
+
+		void reserve(size_t newCapacity) {
+			_chunks.reserve((newCapacity + _chunkCapacity - 1) / _chunkCapacity);
+			while (capacity() < newCapacity) {
+				_chunks.emplace_back(_chunkBytes);
+			}
+			fitVersions();
+		}
+
+		void trim() {
+			_chunks.erase(_chunks.begin() + chunkCount(), _chunks.end());
+			_chunks.shrink_to_fit();
+			fitVersions();
+			_versions.shrink_to_fit();
+		}
+
+		ColumnMemoryVector memory() const {
+			ColumnMemoryVector out;
+			for (const Column& column : _columns) {
+				out.push_back(ColumnMemory{ column.id, column.info->size * _chunkCapacity * _chunks.size() });
+			}
+			return out;
+		}
+
+		template<typename... Components>
+		static Archetype build() {
+			Archetype out;
+			(out.emplaceColumn(componentID<Components>(), &Registry<std::decay_t<Components>>::info()), ...);
+			out.relayout();
+
+			return out;
+		}
+
+		template<typename... Components>
+		static Archetype build(Archetype& source) {
+			Archetype out;
+			(out.emplaceColumn(componentID<Components>(), &Registry<std::decay_t<Components>>::info()), ...);
+
+			for (const Column& column : source._columns) {
+				out.emplaceColumn(column.id, column.info);
+			}
+			out.relayout();
+
+			return out;
+		}
+
+		static Archetype build(Archetype& source, ComponentID without) {
+			Archetype out;
+
+			for (const Column& column : source._columns) {
+				if (column.id != without) {
+					out.emplaceColumn(column.id, column.info);
+				}
+			}
+			out.relayout();
+
+			return out;
+		}
+
+		template<typename... Components>
+		class Cache {
+		public:
+			using ComponentGroup = std::tuple<Components&...>;
+			using ColumnArray = std::array<const Column*, sizeof...(Components)>;
+			using BaseArray = std::array<std::byte*, sizeof...(Components)>;
+
+		private:
+			Archetype* _arche{ nullptr };
+			ColumnArray _columns{};
+			BaseArray _bases{};
+			size_t _first{};
+			size_t _rows{};
+
+		public:
+			Cache() = default;
+
+			Cache(Archetype& arche)
+				: _arche{ &arche }, _columns{ &arche.column(componentID<Components>())... } {
+				if constexpr ((!std::is_const_v<Components> || ...)) {
+					arche.detachChunks();
+				}
+			}
+
+			ComponentGroup group(size_t _index) {
+				if (_index - _first >= _rows) {
+					rebase(_index);
+				}
+				return group(_index - _first, std::index_sequence_for<Components...>{});
+			}
+
+			size_t size() const {
+				if (!_arche) {
+					return 0;
+				}
+				return _arche->size();
+			}
+
+		private:
+			void rebase(size_t _index) {
+				size_t chunk{ _index / _arche->_chunkCapacity };
+				_first = chunk * _arche->_chunkCapacity;
+				_rows = _arche->_chunkCapacity;
+				for (size_t column{}; column < _columns.size(); ++column) {
+					_bases[column] = _arche->_chunks[chunk].data() + _columns[column]->offset;
+				}
+			}
+
+			template<size_t... Indices>
+			ComponentGroup group(size_t row, std::index_sequence<Indices...>) {
+				return ComponentGroup(reinterpret_cast<Components*>(_bases[Indices])[row]...);
+			}
+
+		};
+
+		template<typename... Components>
+		Cache<Components...> _cache() {
+			return Cache<Components...>(*this);
+		}
+
+	private:
+		const Column& column(ComponentID id) const {
+			return _columns[_columnIndices[id]];
+		}
+
+		std::byte* address(const Column& column, size_t _index) {
+			return _chunks[_index / _chunkCapacity].data() + column.offset + (_index % _chunkCapacity) * column.info->size;
+		}
+
+		const std::byte* address(const Column& column, size_t _index) const {
+			return _chunks[_index / _chunkCapacity].data() + column.offset + (_index % _chunkCapacity) * column.info->size;
+		}
+
+		void emplaceColumn(ComponentID id, const ComponentInfo* info) {
+			if (_columnIndices[id] == NO_COLUMN) {
+				_columnIndices[id] = static_cast<uint16_t>(_columns.size());
+				_columns.push_back(Column{ id, info });
+				_signature.set(id);
+			}
+		}
+
+		size_t layoutBytes(size_t chunkCapacity) const {
+			size_t offset{};
+			for (const Column& column : _columns) {
+				offset = Chunk::align(offset, column.info->alignment) + column.info->size * chunkCapacity;
+			}
+			return offset;
+		}
+
+		void relayout() {
+			std::sort(_columns.begin(), _columns.end(), [](const Column& left, const Column& right) {
+				return left.id < right.id;
+			});
+
+			std::fill(_columnIndices.begin(), _columnIndices.end(), NO_COLUMN);
+			size_t rowBytes{};
+			for (size_t _index{}; _index < _columns.size(); ++_index) {
+				_columnIndices[_columns[_index].id] = static_cast<uint16_t>(_index);
+				rowBytes += _columns[_index].info->size;
+			}
+
+			_chunkCapacity = std::max<size_t>(Chunk::SIZE / rowBytes, 1);
+			while (_chunkCapacity > 1 && layoutBytes(_chunkCapacity) > Chunk::SIZE) {
+				--_chunkCapacity;
+			}
+			_chunkBytes = std::max(layoutBytes(_chunkCapacity), Chunk::SIZE);
+
+			size_t offset{};
+			for (Column& column : _columns) {
+				offset = Chunk::align(offset, column.info->alignment);
+				column.offset = offset;
+				offset += column.info->size * _chunkCapacity;
+			}
+
+			_chunks.clear();
+			_versions.clear();
+		}
+
+		static void moveRows(const Column& column, std::byte* dest, std::byte* source, size_t count) {
+			if (column.info->trivial) {
+				std::memcpy(dest, source, count * column.info->size);
+			}
+			else {
+				column.info->moveConstruct(dest, source, count);
+			}
+		}
+
+		static void copyRows(const Column& column, std::byte* dest, const std::byte* source, size_t count) {
+			if (column.info->trivial) {
+				std::memcpy(dest, source, count * column.info->size);
+			}
+			else {
+				column.info->copyConstruct(dest, source, count);
+			}
+		}
+
+		static void relocateRows(const Column& column, std::byte* dest, std::byte* source, size_t count) {
+			if (column.info->trivial) {
+				std::memmove(dest, source, count * column.info->size);
+			}
+			else {
+				column.info->relocate(dest, source, count);
+			}
+		}
+
+		static void destroyRows(const Column& column, std::byte* target, size_t count) {
+			if (!column.info->trivial) {
+				column.info->destroy(target, count);
+			}
+		}
+
+		static void pushRun(RunVector& runs, size_t target, size_t source, size_t targetCapacity, size_t sourceCapacity) {
+			if (!runs.empty()) {
+				Run& last{ runs.back() };
+				if (last.target + last.count == target && last.source + last.count == source
+					&& target % targetCapacity != 0 && source % sourceCapacity != 0) {
+					++last.count;
+					return;
+				}
+			}
+			runs.push_back(Run{ target, source, 1 });
+		}
+
+		void fitVersions() {
+			_versions.resize(_chunks.size() * _columns.size());
+		}
+
+		void detach(size_t chunk) {
+			if (chunk >= _chunks.size() || !_chunks[chunk].shared()) {
+				return;
+			}
+
+			Chunk copy{ _chunkBytes };
+			size_t rows{ _size > chunk * _chunkCapacity ? chunkSize(chunk) : 0 };
+			for (const Column& column : _columns) {
+				copyRows(column, copy.data() + column.offset, _chunks[chunk].data() + column.offset, rows);
+			}
+			_chunks[chunk] = std::move(copy);
+		}
+
+		void detachRows(size_t first, size_t count) {
+			if (count == 0) {
+				return;
+			}
+
+			for (size_t chunk{ first / _chunkCapacity }; chunk <= (first + count - 1) / _chunkCapacity; ++chunk) {
+				detach(chunk);
+			}
+		}
+
+		void releaseChunks() {
+			size_t usedChunks{ chunkCount() };
+			if (_chunks.size() > usedChunks + 1) {
+				_chunks.erase(_chunks.begin() + usedChunks + 1, _chunks.end());
+				fitVersions();
+			}
+		}
+
+	};
+
+}
\ No newline at end of file
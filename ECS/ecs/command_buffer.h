@@ -0,0 +1,578 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <map>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <type_traits>
+
+#include "component.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	class CommandBuffer {
+	public:
+		using World = WorldType;
+		using Archetype = typename World::Archetype;
+		using EntityID = typename World::EntityID;
+		using EntityIDGenerator = typename World::EntityIDGenerator;
+		using EntityData = typename World::EntityData;
+		using Signature = typename World::Signature;
+
+	private:
+		enum class CommandType : uint8_t {
+			CREATE,
+			DESTROY,
+			ATTACH,
+			DETACH
+		};
+
+		class IComponentQueue;
+
+		struct Command {
+			CommandType type{};
+			EntityID id{};
+			ComponentID component{};
+			size_t slot{};
+			bool sparse{};
+			IComponentQueue* queue{ nullptr };
+		};
+
+		class IComponentQueue {
+		public:
+			virtual ~IComponentQueue() = default;
+
+			virtual Archetype* attach(World& world, Archetype* arche) = 0;
+
+			virtual void place(Archetype& arche, size_t first, const size_t* slots, size_t count) = 0;
+
+			virtual void assign(Archetype& arche, size_t _index, size_t slot) = 0;
+
+			virtual void attachSparse(World& world, EntityID id, size_t slot) = 0;
+
+			virtual void clear() = 0;
+		};
+
+		template<typename Component>
+		class ComponentQueue : public IComponentQueue {
+		private:
+			std::vector<Component> _components;
+
+		public:
+			template<typename _Component>
+			size_t push(_Component&& component) {
+				_components.push_back(std::forward<_Component>(component));
+				return _components.size() - 1;
+			}
+
+			Archetype* attach(World& world, Archetype* arche) override {
+				return world.template attachEdge<Component>(arche);
+			}
+
+			void place(Archetype& arche, size_t first, const size_t* slots, size_t count) override {
+				for (size_t _index{}; _index < count; ++_index) {
+					arche.template placeComponent<Component>(first + _index, std::move(_components[slots[_index]]));
+				}
+			}
+
+			void assign(Archetype& arche, size_t _index, size_t slot) override {
+				arche.template getComponent<Component>(_index) = std::move(_components[slot]);
+			}
+
+			void attachSparse(World& world, EntityID id, size_t slot) override {
+				if constexpr (SPARSE_COMPONENT<Component>) {
+					world.attach(id, std::move(_components[slot]));
+				}
+			}
+
+			void clear() override {
+				_components.clear();
+			}
+		};
+
+		using UComponentQueue = std::unique_ptr<IComponentQueue>;
+		using QueueMap = std::unordered_map<ComponentID, UComponentQueue>;
+
+		struct Change {
+			ComponentID component{};
+			size_t slot{};
+			bool attach{};
+			IComponentQueue* queue{ nullptr };
+		};
+
+		struct Pending {
+			EntityID id{};
+			size_t firstChange{};
+			size_t changeCount{};
+			EntityData* data{ nullptr };
+			bool destroyed{ false };
+		};
+
+		struct Group {
+			Archetype* source{ nullptr };
+			Archetype* dest{ nullptr };
+			Signature placed;
+			std::vector<size_t> members;
+		};
+
+		using GroupKey = std::pair<Archetype*, Archetype*>;
+		using GroupMap = std::map<GroupKey, std::vector<size_t>>;
+		using GroupVector = std::vector<Group>;
+		using DepartureMap = std::unordered_map<Archetype*, std::vector<size_t>>;
+
+		inline static constexpr size_t NO_GROUP{ std::numeric_limits<size_t>::max() };
+
+		World* _world;
+		std::vector<Command> _commands;
+		QueueMap _queues;
+
+	public:
+		CommandBuffer(World& world)
+			: _world{ &world } {
+		}
+
+		CommandBuffer(const CommandBuffer& left) = delete;
+
+		CommandBuffer(CommandBuffer&& right) noexcept
+			: _world{ right._world }, _commands{ std::move(right._commands) }, _queues{ std::move(right._queues) } {
+			right._commands.clear();
+		}
+
+		CommandBuffer& operator=(const CommandBuffer& left) = delete;
+
+		CommandBuffer& operator=(CommandBuffer&& right) noexcept {
+			if (this != &right) {
+				release();
+				_world = right._world;
+				_commands = std::move(right._commands);
+				_queues = std::move(right._queues);
+				right._commands.clear();
+			}
+			return *this;
+		}
+
+		~CommandBuffer() {
+			release();
+		}
+
+		EntityID create() {
+			EntityID id{ _world->reserveEntityConcurrent() };
+			_commands.push_back(Command{ CommandType::CREATE, id });
+			return id;
+		}
+
+		template<typename Component, typename... Components>
+		EntityID create(Component&& component, Components&&... components) {
+			EntityID out{ create() };
+
+			attach(out,
+				std::forward<Component>(component),
+				std::forward<Components>(components)...);
+			return out;
+		}
+
+		void destroy(EntityID id) {
+			_commands.push_back(Command{ CommandType::DESTROY, id });
+		}
+
+		template<typename Component, typename... Components>
+		void attach(EntityID id, Component&& component, Components&&... components) {
+			push(id, std::forward<Component>(component));
+			(push(id, std::forward<Components>(components)), ...);
+		}
+
+		template<typename Component>
+		void detach(EntityID id) {
+			_commands.push_back(Command{ CommandType::DETACH, id, World::template componentID<Component>(), 0, SPARSE_COMPONENT<Component> });
+		}
+
+		size_t size() const {
+			return _commands.size();
+		}
+
+		bool empty() const {
+			return _commands.empty();
+		}
+
+		void clear() {
+			release();
+			reset();
+		}
+
+		void playback() {
+			World& world{ *_world };
+			std::vector<Pending> pendings;
+			std::vector<Change> changes;
+			std::vector<Command> sparse;
+			collect(world, pendings, changes, sparse);
+
+			GroupMap keys;
+			GroupVector groups;
+			DepartureMap departures;
+			size_t last{ NO_GROUP };
+			const Pending* previous{ nullptr };
+
+			for (size_t _index{}; _index < pendings.size(); ++_index) {
+				Pending& pending{ pendings[_index] };
+				pending.data = &world._entities.at(pending.id);
+
+				if (pending.destroyed) {
+					world.observeDestroy(pending.id, pending.data->arche);
+					if (pending.data->arche) {
+						departures[pending.data->arche].push_back(pending.data->_index);
+					}
+					continue;
+				}
+
+				Archetype* source{ pending.data->arche };
+
+				// Runs of entities with the same archetype and change list share the last group.
+				if (!(previous && groups[last].source == source && same(*previous, pending, changes))) {
+					Archetype* dest{ destination(world, pending, changes) };
+					last = group(keys, groups, source, dest, placed(source, pending, changes));
+				}
+				groups[last].members.push_back(_index);
+				previous = &pending;
+			}
+
+			for (Group& group : groups) {
+				move(world, group, pendings, changes, departures);
+			}
+
+			for (auto& [arche, indices] : departures) {
+				std::sort(indices.begin(), indices.end(), std::greater<size_t>{});
+				arche->eraseEntities(indices.data(), indices.size());
+
+				for (size_t _index : indices) {
+					if (_index < arche->size()) {
+						world._entities.at(arche->template getComponent<EntityID>(_index))._index = _index;
+						arche->touchRows(_index, 1, world._tick);
+					}
+				}
+			}
+
+			for (const Pending& pending : pendings) {
+				if (pending.destroyed) {
+					world.eraseSparse(pending.id);
+					world._entities.erase(pending.id);
+					++world._counters.destroys;
+				}
+			}
+
+			for (const Command& command : sparse) {
+				if (!world.contains(command.id)) {
+					continue;
+				}
+
+				if (command.type == CommandType::ATTACH) {
+					command.queue->attachSparse(world, command.id, command.slot);
+				}
+				else {
+					world.eraseSparse(command.component, command.id);
+					++world._counters.detaches;
+				}
+			}
+
+			reset();
+		}
+
+	private:
+		void release() {
+			for (const Command& command : _commands) {
+				if (command.type == CommandType::CREATE) {
+					_world->releaseEntity(command.id);
+				}
+			}
+		}
+
+		void reset() {
+			_commands.clear();
+			for (auto& pair : _queues) {
+				pair.second->clear();
+			}
+		}
+
+		template<typename Component>
+		void push(EntityID id, Component&& component) {
+			using Type = std::decay_t<Component>;
+
+			ComponentID type{ World::template componentID<Type>() };
+			auto result{ _queues.find(type) };
+			if (result == _queues.end()) {
+				result = _queues.emplace(type, std::make_unique<ComponentQueue<Type>>()).first;
+			}
+
+			IComponentQueue* queue{ result->second.get() };
+			size_t slot{ static_cast<ComponentQueue<Type>*>(queue)->push(std::forward<Component>(component)) };
+			_commands.push_back(Command{ CommandType::ATTACH, id, type, slot, SPARSE_COMPONENT<Type>, queue });
+		}
+
+		void collect(World& world, std::vector<Pending>& pendings, std::vector<Change>& changes, std::vector<Command>& sparse) {
+			typename EntityIDGenerator::template Map<size_t> indices;
+			std::vector<Change> ordered;
+			std::vector<size_t> owners;
+			size_t owner{};
+			bool contiguous{ true };
+			indices.reserve(_commands.size());
+			pendings.reserve(_commands.size());
+			ordered.reserve(_commands.size());
+			owners.reserve(_commands.size());
+
+			for (const Command& command : _commands) {
+				if (command.type == CommandType::CREATE) {
+					world._entities.emplace(command.id, EntityData{});
+					++world._counters.creates;
+				}
+
+				if (pendings.empty() || pendings[owner].id != command.id) {
+					auto result{ indices.find(command.id) };
+					if (result == indices.end()) {
+						owner = pendings.size();
+						indices.emplace(command.id, owner);
+						pendings.push_back(Pending{ command.id });
+					}
+					else {
+						owner = result->second;
+						contiguous = false;
+					}
+				}
+
+				if (command.type == CommandType::DESTROY) {
+					pendings[owner].destroyed = true;
+				}
+				else if (command.sparse) {
+					sparse.push_back(command);
+				}
+				else if (command.type == CommandType::ATTACH || command.type == CommandType::DETACH) {
+					ordered.push_back(Change{ command.component, command.slot, command.type == CommandType::ATTACH, command.queue });
+					owners.push_back(owner);
+					++pendings[owner].changeCount;
+				}
+			}
+
+			size_t first{};
+			for (Pending& pending : pendings) {
+				pending.firstChange = first;
+				first += pending.changeCount;
+				if (!contiguous) {
+					pending.changeCount = 0;
+				}
+			}
+
+			if (contiguous) {
+				changes = std::move(ordered);
+			}
+			else {
+				changes.resize(ordered.size());
+				for (size_t _index{}; _index < ordered.size(); ++_index) {
+					Pending& pending{ pendings[owners[_index]] };
+					changes[pending.firstChange + pending.changeCount++] = ordered[_index];
+				}
+			}
+
+			for (Pending& pending : pendings) {
+				Change* entity{ changes.data() + pending.firstChange };
+				size_t count{};
+
+				for (size_t _index{}; _index < pending.changeCount; ++_index) {
+					Change* change{ std::find_if(entity, entity + count, [&](const Change& change) {
+						return change.component == entity[_index].component;
+					}) };
+
+					if (change != entity + count) {
+						change->attach = entity[_index].attach;
+						change->slot = entity[_index].slot;
+						change->queue = entity[_index].queue;
+					}
+					else {
+						entity[count++] = entity[_index];
+					}
+				}
+
+				pending.changeCount = count;
+				for (size_t _index{}; _index < count; ++_index) {
+					++(entity[_index].attach ? world._counters.attaches : world._counters.detaches);
+				}
+			}
+		}
+
+		Archetype* destination(World& world, const Pending& pending, const std::vector<Change>& changes) {
+			Archetype* dest{ pending.data->arche };
+
+			for (size_t _index{}; _index < pending.changeCount; ++_index) {
+				const Change& change{ changes[pending.firstChange + _index] };
+				bool has{ dest && dest->signature().test(change.component) };
+
+				if (change.attach && !has) {
+					dest = change.queue->attach(world, dest);
+				}
+				else if (!change.attach && has) {
+					dest = world.detachEdge(dest, change.component);
+				}
+			}
+
+			return dest;
+		}
+
+		static bool same(const Pending& first, const Pending& second, const std::vector<Change>& changes) {
+			if (first.changeCount != second.changeCount) {
+				return false;
+			}
+
+			for (size_t _index{}; _index < first.changeCount; ++_index) {
+				const Change& left{ changes[first.firstChange + _index] };
+				const Change& right{ changes[second.firstChange + _index] };
+				if (left.component != right.component || left.attach != right.attach) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static Signature placed(const Archetype* source, const Pending& pending, const std::vector<Change>& changes) {
+			Signature out;
+			for (size_t _index{}; _index < pending.changeCount; ++_index) {
+				const Change& change{ changes[pending.firstChange + _index] };
+				if (change.attach && !(source && source->signature().test(change.component))) {
+					out.set(change.component);
+				}
+			}
+			return out;
+		}
+
+		static size_t group(GroupMap& keys, GroupVector& groups, Archetype* source, Archetype* dest, const Signature& placed) {
+			std::vector<size_t>& candidates{ keys[GroupKey{ source, dest }] };
+			for (size_t candidate : candidates) {
+				if (groups[candidate].placed == placed) {
+					return candidate;
+				}
+			}
+
+			candidates.push_back(groups.size());
+			groups.push_back(Group{ source, dest, placed, {} });
+			return groups.size() - 1;
+		}
+
+		void move(
+			World& world,
+			const Group& group,
+			const std::vector<Pending>& pendings,
+			const std::vector<Change>& changes,
+			DepartureMap& departures) {
+			Archetype* source{ group.source };
+			Archetype* dest{ group.dest };
+			const std::vector<size_t>& members{ group.members };
+
+			if (!dest) {
+				if (source) {
+					for (size_t member : members) {
+						departures[source].push_back(pendings[member].data->_index);
+						pendings[member].data->arche = nullptr;
+					}
+					world._counters.moves += members.size();
+				}
+				return;
+			}
+
+			if (source == dest) {
+				for (size_t member : members) {
+					const Pending& pending{ pendings[member] };
+					assign(*dest, pending.data->_index, pending, changes);
+					dest->touchRows(pending.data->_index, 1, world._tick);
+					observeChanges(world, pending, changes, dest);
+				}
+				return;
+			}
+
+			std::vector<EntityID> ids;
+			std::vector<size_t> indices;
+			ids.reserve(members.size());
+			indices.reserve(members.size());
+
+			for (size_t member : members) {
+				ids.push_back(pendings[member].id);
+				indices.push_back(pendings[member].data->_index);
+			}
+
+			size_t first{ source
+				? dest->carryEntities(ids.data(), indices.data(), ids.size(), *source)
+				: dest->pushEntities(ids.data(), ids.size()) };
+			dest->touchRows(first, ids.size(), world._tick);
+			world._counters.moves += ids.size();
+			world.observeMove(source, dest, ids.data(), ids.size());
+
+			const Pending& front{ pendings[members.front()] };
+			std::vector<size_t> slots(members.size());
+
+			for (size_t _index{}; _index < front.changeCount; ++_index) {
+				const Change& change{ changes[front.firstChange + _index] };
+				if (!group.placed.test(change.component)) {
+					continue;
+				}
+
+				for (size_t member{}; member < members.size(); ++member) {
+					slots[member] = find(pendings[members[member]], change.component, changes).slot;
+				}
+				change.queue->place(*dest, first, slots.data(), slots.size());
+			}
+
+			for (size_t _index{}; _index < members.size(); ++_index) {
+				const Pending& pending{ pendings[members[_index]] };
+				if (source) {
+					assign(*dest, first + _index, pending, changes, source);
+					observeChanges(world, pending, changes, source);
+				}
+
+				pending.data->arche = dest;
+				pending.data->_index = first + _index;
+			}
+
+			if (source) {
+				std::vector<size_t>& departing{ departures[source] };
+				departing.insert(departing.end(), indices.begin(), indices.end());
+			}
+		}
+
+		void assign(
+			Archetype& arche,
+			size_t _index,
+			const Pending& pending,
+			const std::vector<Change>& changes,
+			Archetype* source = nullptr) {
+			for (size_t change{}; change < pending.changeCount; ++change) {
+				const Change& current{ changes[pending.firstChange + change] };
+				if (current.attach && (!source || source->signature().test(current.component))) {
+					current.queue->assign(arche, _index, current.slot);
+				}
+			}
+		}
+
+		static void observeChanges(World& world, const Pending& pending, const std::vector<Change>& changes, Archetype* source) {
+			for (size_t change{}; change < pending.changeCount; ++change) {
+				const Change& current{ changes[pending.firstChange + change] };
+				if (current.attach && source->signature().test(current.component)) {
+					world.observe(ObserverEvent::CHANGE, current.component, &pending.id, 1);
+				}
+			}
+		}
+
+		static const Change& find(const Pending& pending, ComponentID component, const std::vector<Change>& changes) {
+			for (size_t _index{}; _index < pending.changeCount; ++_index) {
+				if (changes[pending.firstChange + _index].component == component) {
+					return changes[pending.firstChange + _index];
+				}
+			}
+			assert(false && "Grouped entities must place the same components");
+			return changes[pending.firstChange];
+		}
+
+	};
+
+}
\ No newline at end of file
@@ -1,6 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <type_traits>
 
 namespace Byte {
 
@@ -18,10 +24,59 @@ namespace Byte {
 
 	};
 
+	struct ComponentInfo {
+		size_t size{};
+		size_t alignment{};
+		bool trivial{};
+
+		void (*moveConstruct)(void* dest, void* source, size_t count) { nullptr };
+		void (*copyConstruct)(void* dest, const void* source, size_t count) { nullptr };
+		void (*fillConstruct)(void* dest, const void* source, size_t count) { nullptr };
+		void (*relocate)(void* dest, void* source, size_t count) { nullptr };
+		void (*destroy)(void* target, size_t count) { nullptr };
+
+		template<typename Component>
+		static ComponentInfo build() {
+			ComponentInfo out;
+			out.size = sizeof(Component);
+			out.alignment = alignof(Component);
+			out.trivial = std::is_trivially_copyable_v<Component>;
+
+			out.moveConstruct = [](void* dest, void* source, size_t count) {
+				std::uninitialized_move_n(static_cast<Component*>(source), count, static_cast<Component*>(dest));
+			};
+
+			out.copyConstruct = [](void* dest, const void* source, size_t count) {
+				std::uninitialized_copy_n(static_cast<const Component*>(source), count, static_cast<Component*>(dest));
+			};
+
+			out.fillConstruct = [](void* dest, const void* source, size_t count) {
+				std::uninitialized_fill_n(static_cast<Component*>(dest), count, *static_cast<const Component*>(source));
+			};
+
+			out.relocate = [](void* dest, void* source, size_t count) {
+				if constexpr (std::is_trivially_copyable_v<Component>) {
+					std::memmove(dest, source, count * sizeof(Component));
+				}
+				else {
+					std::uninitialized_move_n(static_cast<Component*>(source), count, static_cast<Component*>(dest));
+					std::destroy_n(static_cast<Component*>(source), count);
+				}
+			};
+
+			out.destroy = [](void* target, size_t count) {
+				std::destroy_n(static_cast<Component*>(target), count);
+			};
+
+			return out;
+		}
+	};
+
 	template<typename Component>
 	class Registry {
 	private:
 		inline static ComponentID _id{ ComponentIDGenerator::template generate<Component>() };
+		inline static ComponentInfo _info{ ComponentInfo::template build<Component>() };
 
 	public:
 		static ComponentID id() {
@@ -32,6 +87,56 @@ namespace Byte {
 			_id = newID;
 		}
 
+		static const ComponentInfo& info() {
+			return _info;
+		}
+
+	};
+
+	template<typename Component>
+	struct ComponentStorage {
+		inline static constexpr bool SPARSE{ false };
+	};
+
+	template<typename Component>
+	inline constexpr bool SPARSE_COMPONENT{ ComponentStorage<std::remove_cv_t<Component>>::SPARSE };
+
+	template<typename... Components>
+	using DenseComponents = decltype(std::tuple_cat(
+		std::declval<std::conditional_t<SPARSE_COMPONENT<Components>, std::tuple<>, std::tuple<Components>>>()...));
+
+	template<template<typename...> class Target, typename Tuple>
+	struct ApplyComponents;
+
+	template<template<typename...> class Target, typename... Components>
+	struct ApplyComponents<Target, std::tuple<Components...>> {
+		using Type = Target<Components...>;
+	};
+
+	template<typename... Components>
+	struct ComponentList {
+		inline static constexpr size_t SIZE{ sizeof...(Components) };
+
+		template<typename Component>
+		inline static constexpr bool CONTAINS{ (std::is_same_v<Component, Components> || ...) };
+
+		template<typename Component>
+		static constexpr ComponentID index() {
+			ComponentID out{};
+			ComponentID current{};
+			((std::is_same_v<Component, Components> ? out = current++ : current++), ...);
+			return out;
+		}
+
+		template<typename Component>
+		static constexpr ComponentID id() {
+			if constexpr (CONTAINS<Component>) {
+				return index<Component>();
+			}
+			else {
+				return static_cast<ComponentID>(SIZE) + Registry<Component>::id();
+			}
+		}
 	};
 
 }
\ No newline at end of file
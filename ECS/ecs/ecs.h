@@ -3,8 +3,20 @@
 #include <cstdint>
 #include <vector>
 #include <random>
+#include <atomic>
+#include <mutex>
+#include <iterator>
+#include <algorithm>
 
 #include "world.h"
+#include "slot_map.h"
+#include "chunk.h"
+#include "command_buffer.h"
+#include "staging.h"
+#include "serializer.h"
+#include "prefab.h"
+#include "scheduler.h"
+#include "hierarchy.h"
 #include "utility.h"
 
 namespace Byte {
@@ -32,8 +44,11 @@ namespace Byte {
 
     private:
         void check_shrink() {
-            if (this->size() < this->capacity() / 2) {
-                this->shrink_to_fit();
+            if (this->size() < this->capacity() / 4) {
+                std::vector<Type> shrunk;
+                shrunk.reserve(this->size() * 2);
+                std::move(this->begin(), this->end(), std::back_inserter(shrunk));
+                this->swap(shrunk);
             }
         }
     };
@@ -60,16 +75,123 @@ namespace Byte {
 
     template<typename EntityID>
     struct EntityIDGenerator {
+        template<typename Value>
+        using Map = hash_map<EntityID, Value>;
+
         inline static std::random_device rd;
-        inline static std::mt19937_64 generator;
-        inline static std::uniform_int_distribution<uint64_t> distribution;
+        inline static std::mutex rdMutex;
+        inline static std::atomic<uint64_t> streams{ 0 };
+
+        static uint64_t seed() {
+            std::lock_guard<std::mutex> lock{ rdMutex };
+            uint64_t out{ static_cast<uint64_t>(rd()) << 32 | rd() };
+            return out ^ streams.fetch_add(1) * 0x9E3779B97F4A7C15ull;
+        }
+
+        inline static thread_local std::mt19937_64 generator{ seed() };
+        inline static thread_local std::uniform_int_distribution<uint64_t> distribution{ 1 };
 
         static EntityID generate() {
             return EntityID{ distribution(generator) };
         }
+
+        template<typename Map>
+        static EntityID generate(Map& map) {
+            EntityID out{ generate() };
+            while (map.find(out) != map.end()) {
+                out = generate();
+            }
+            return out;
+        }
+
+        template<typename Map>
+        static void generate(Map& map, EntityID* out, size_t count) {
+            for (size_t _index{}; _index < count; ++_index) {
+                out[_index] = generate(map);
+            }
+        }
+
+        template<typename Map>
+        static EntityID reserve(Map&) {
+            return generate();
+        }
+
+        template<typename Map>
+        static void release(Map&, EntityID) {
+        }
     };
 
-    using World = _World<EntityID, EntityIDGenerator, shrink_vector, 1024>;
+    struct GenerationalID {
+        uint32_t index{};
+        uint32_t version{};
+
+        explicit operator uint64_t() const {
+            return static_cast<uint64_t>(version) << 32 | index;
+        }
+
+        explicit operator bool() const {
+            return version != 0;
+        }
+
+        bool operator==(const GenerationalID& entity) const {
+            return entity.index == index && entity.version == version;
+        }
+
+        bool operator!=(const GenerationalID& entity) const {
+            return !(*this == entity);
+        }
+    };
+
+    template<typename EntityID>
+    struct GenerationalIDGenerator {
+        template<typename Value>
+        using Map = slot_map<EntityID, Value>;
+
+        template<typename Map>
+        static EntityID generate(Map& map) {
+            return map.generate();
+        }
+
+        template<typename Map>
+        static void generate(Map& map, EntityID* out, size_t count) {
+            map.generate(out, count);
+        }
+
+        template<typename Map>
+        static EntityID reserve(Map& map) {
+            return map.reserve_key();
+        }
+
+        template<typename Map>
+        static void release(Map& map, EntityID id) {
+            map.release_key(id);
+        }
+    };
+
+    using World = _World<EntityID, EntityIDGenerator, chunk_storage, 1024>;
+
+    using ChunkedWorld = World;
+
+    using VectorWorld = _World<EntityID, EntityIDGenerator, shrink_vector, 1024>;
+
+    using DenseWorld = _World<GenerationalID, GenerationalIDGenerator, chunk_storage, 1024>;
+
+    using DenseChunkedWorld = DenseWorld;
+
+    using DenseVectorWorld = _World<GenerationalID, GenerationalIDGenerator, shrink_vector, 1024>;
+
+    template<typename... Components>
+    using StaticWorld = _World<EntityID, EntityIDGenerator, chunk_storage, 1024, ComponentList<EntityID, Components...>>;
+
+    template<typename... Components>
+    using StaticChunkedWorld = StaticWorld<Components...>;
+
+    template<typename... Components>
+    using StaticVectorWorld = _World<EntityID, EntityIDGenerator, shrink_vector, 1024, ComponentList<EntityID, Components...>>;
+
+    using Parent = _Parent<EntityID>;
+
+    using Children = _Children<EntityID>;
 
 }
 
@@ -82,4 +204,11 @@ namespace std {
         }
     };
 
+    template<>
+    struct hash<Byte::GenerationalID> {
+        size_t operator()(const Byte::GenerationalID& entity) const noexcept {
+            return std::hash<uint64_t>{}(static_cast<uint64_t>(entity));
+        }
+    };
+
 }
\ No newline at end of file
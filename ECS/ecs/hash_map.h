@@ -4,35 +4,77 @@
 #include <utility>
 #include <limits>
 #include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <array>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BYTE_HASH_MAP_SSE2
+#endif
 
 namespace Byte {
 
-	struct double_hash_probe {
-		inline static constexpr size_t prime_factor{ 7 };
+	struct hash_group {
+		inline static constexpr size_t width{ 16 };
+
+		inline static constexpr int8_t empty{ -128 };
+		inline static constexpr int8_t deleted{ -2 };
 
-		size_t operator()(const size_t primary_hash, const size_t attempt) const {
-			return primary_hash + attempt * (prime_factor - (primary_hash % prime_factor));
+#ifdef BYTE_HASH_MAP_SSE2
+		__m128i ctrl;
+
+		explicit hash_group(const int8_t* position)
+			: ctrl{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(position)) } {
 		}
-	};
 
-	struct linear_probe {
-		size_t operator()(const size_t primary_hash, const size_t attempt) const {
-			return primary_hash + attempt;
+		uint32_t match(int8_t hash) const {
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(hash))));
+		}
+
+		uint32_t match_empty() const {
+			return match(empty);
 		}
-	};
 
-	struct quadratic_probe {
-		size_t operator()(const size_t primary_hash, const size_t attempt) const {
-			return primary_hash + attempt * attempt;
+		uint32_t match_empty_or_deleted() const {
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(ctrl, _mm_set1_epi8(-1))));
 		}
+#else
+		int8_t ctrl[width];
+
+		explicit hash_group(const int8_t* position) {
+			std::memcpy(ctrl, position, width);
+		}
+
+		uint32_t match(int8_t hash) const {
+			uint32_t out{};
+			for (size_t idx{}; idx < width; ++idx) {
+				out |= static_cast<uint32_t>(ctrl[idx] == hash) << idx;
+			}
+			return out;
+		}
+
+		uint32_t match_empty() const {
+			return match(empty);
+		}
+
+		uint32_t match_empty_or_deleted() const {
+			uint32_t out{};
+			for (size_t idx{}; idx < width; ++idx) {
+				out |= static_cast<uint32_t>(ctrl[idx] < -1) << idx;
+			}
+			return out;
+		}
+#endif
 	};
 
 	template<
 		typename _Key,
 		typename _Value,
 		typename _Hasher = std::hash<_Key>,
-		typename _Keyequal = std::equal_to<_Key>,
-		typename _Probe = double_hash_probe>
+		typename _Keyequal = std::equal_to<_Key>>
 	class hash_map {
 	public:
 		using key_type = _Key;
@@ -40,37 +82,34 @@ namespace Byte {
 
 		using hasher = _Hasher;
 		using key_equal = _Keyequal;
-		using probe = _Probe;
 
 		using map_node = std::pair<_Key, _Value>;
 
 	private:
 		inline static constexpr size_t empty_index{ std::numeric_limits<size_t>::max() };
-		inline static constexpr size_t deleted_index{ empty_index - 1 };
-		inline static constexpr size_t rehash_factor{ 3 };
+		inline static constexpr size_t min_capacity{ hash_group::width };
+		inline static constexpr size_t cloned_bytes{ hash_group::width - 1 };
 
 		using node_vector = std::vector<map_node>;
-		node_vector _nodes;
-
-		struct index_node {
-			size_t _index{ empty_index };
-			size_t hash_value{};
-		};
+		using ctrl_vector = std::vector<int8_t>;
+		using slot_vector = std::vector<uint32_t>;
 
-		using index_vector = std::vector<index_node>;
-		index_vector _indices;
+		node_vector _nodes;
+		ctrl_vector _ctrl;
+		slot_vector _slots;
+		size_t _growth_left{};
 
 		hasher _hash;
 		key_equal _equal;
-		probe _probe;
 
 	public:
+		using probe_histogram = std::array<size_t, 8>;
 		using iterator = typename node_vector::iterator;
 		using const_iterator = typename node_vector::const_iterator;
 
 	public:
 		hash_map() {
-			_indices.resize(rehash_factor);
+			resize_table(min_capacity);
 		}
 
 		value_type& at(const key_type& key) {
@@ -80,7 +119,7 @@ namespace Byte {
 				throw std::out_of_range("Key not found");
 			}
 
-			return _nodes[_indices[_index]._index].second;
+			return _nodes[_slots[_index]].second;
 		}
 
 		const value_type& at(const key_type& key) const {
@@ -90,20 +129,25 @@ namespace Byte {
 				throw std::out_of_range("Key not found");
 			}
 
-			return _nodes[_indices[_index]._index].second;
+			return _nodes[_slots[_index]].second;
 		}
 
 		template<typename... _Args >
-		void emplace(_Args... args) {
+		void emplace(_Args&&... args) {
+			if (_growth_left == 0) {
+				rehash(size() * 32 <= _slots.size() * 25 ? _slots.size() : _slots.size() * 2);
+			}
+
 			_nodes.emplace_back(std::forward<_Args>(args)...);
-			size_t primary_hash{ _hash(_nodes.back().first) };
-			size_t free_index{ find_free_index(primary_hash) };
-			_indices[free_index]._index = _nodes.size() - 1;
-			_indices[free_index].hash_value = primary_hash;
 
-			if (need_expand()) {
-				rehash(_indices.size() * rehash_factor);
+			size_t hash_value{ hash_of(_nodes.back().first) };
+			size_t _index{ find_free_index(hash_value) };
+			if (_ctrl[_index] == hash_group::empty) {
+				--_growth_left;
 			}
+
+			set_ctrl(_index, h2(hash_value));
+			_slots[_index] = static_cast<uint32_t>(_nodes.size() - 1);
 		}
 
 		const value_type& operator[](const key_type& key) const {
@@ -114,48 +158,51 @@ namespace Byte {
 			size_t _index{ find_index(key) };
 
 			if (_index != empty_index) {
-				return _nodes[_indices[_index]._index].second;
+				return _nodes[_slots[_index]].second;
 			}
 
-			emplace(key,value_type{});
+			emplace(key, value_type{});
 
 			return _nodes.back().second;
 		}
 
 		iterator find(const key_type& key) {
-			size_t _index = find_index(key);
+			size_t _index{ find_index(key) };
 			if (_index != empty_index) {
-				return iterator{ _nodes.begin() + _indices[_index]._index };
+				return _nodes.begin() + _slots[_index];
 			}
 			return end();
 		}
 
 		const_iterator find(const key_type& key) const {
-			size_t _index = find_index(key);
+			size_t _index{ find_index(key) };
 			if (_index != empty_index) {
-				return const_iterator{ _nodes.begin() + _indices[_index]._index };
+				return _nodes.begin() + _slots[_index];
 			}
 			return end();
 		}
 
-		void erase(const key_type& key) {
-			size_t node_index{ find_index(key) };
+		bool contains(const key_type& key) const {
+			return find_index(key) != empty_index;
+		}
 
-			if (node_index != empty_index) {
-				size_t back_index{ find_index(_nodes.back().first) };
-				size_t node_pos{ _indices[node_index]._index };
-				_indices[back_index]._index = _indices[node_index]._index;
-				_indices[node_index]._index = deleted_index;
+		void erase(const key_type& key) {
+			size_t _index{ find_index(key) };
 
-				std::swap(_nodes[node_pos], _nodes.back());
+			if (_index == empty_index) {
+				return;
+			}
 
-				_nodes.pop_back();
+			size_t node_pos{ _slots[_index] };
+			set_ctrl(_index, hash_group::deleted);
 
-				if (need_shrink()) {
-					rehash(_indices.size() / rehash_factor);
-					_nodes.shrink_to_fit();
-				}
+			if (node_pos != _nodes.size() - 1) {
+				size_t back_index{ find_index(_nodes.back().first) };
+				_slots[back_index] = static_cast<uint32_t>(node_pos);
+				_nodes[node_pos] = std::move(_nodes.back());
 			}
+
+			_nodes.pop_back();
 		}
 
 		size_t size() const {
@@ -166,9 +213,25 @@ namespace Byte {
 			return _nodes.capacity();
 		}
 
+		float load_factor() const {
+			return static_cast<float>(_nodes.size()) / _slots.size();
+		}
+
+		probe_histogram probes() const {
+			probe_histogram out{};
+			for (const map_node& node : _nodes) {
+				++out[std::min(probe_length(node.first), out.size() - 1)];
+			}
+			return out;
+		}
+
 		void reserve(size_t new_capacity) {
 			_nodes.reserve(new_capacity);
-			_indices.resize(rehash_factor * new_capacity);
+
+			size_t table_capacity{ capacity_for(new_capacity) };
+			if (table_capacity > _slots.size()) {
+				rehash(table_capacity);
+			}
 		}
 
 		iterator begin() {
@@ -189,61 +252,101 @@ namespace Byte {
 
 		void clear() {
 			_nodes.clear();
-			_indices.clear();
-			_indices.resize(rehash_factor);
+			resize_table(min_capacity);
 		}
 
 	private:
-		bool need_expand() const {
-			return size() > _indices.size() / rehash_factor;
+		size_t hash_of(const key_type& key) const {
+			uint64_t value{ static_cast<uint64_t>(_hash(key)) * 0x9E3779B97F4A7C15ull };
+			return static_cast<size_t>(value ^ (value >> 32));
 		}
 
-		bool need_shrink() const {
-			return size() * rehash_factor < _indices.size() / rehash_factor;
+		static int8_t h2(size_t hash_value) {
+			return static_cast<int8_t>(hash_value & 0x7F);
 		}
 
-		bool full_index(size_t _index) const {
-			return _indices[_index]._index < deleted_index;
+		size_t mask() const {
+			return _slots.size() - 1;
 		}
 
-		size_t find_free_index(size_t primary_hash) const {
-			size_t hash_value{ primary_hash % _indices.size() };
-
-			for (size_t attempt{ 1 }; _indices[hash_value]._index != empty_index; ++attempt) {
-				hash_value = _probe(primary_hash, attempt) % _indices.size();
+		static size_t capacity_for(size_t count) {
+			size_t out{ min_capacity };
+			while (out - out / 8 < count + 1) {
+				out *= 2;
 			}
+			return out;
+		}
 
-			return hash_value;
+		void set_ctrl(size_t _index, int8_t value) {
+			_ctrl[_index] = value;
+			_ctrl[((_index - cloned_bytes) & mask()) + cloned_bytes] = value;
 		}
 
 		size_t find_index(const key_type& key) const {
-			size_t primary_hash{ _hash(key) };
-			size_t hash_value{ primary_hash % _indices.size() };
+			size_t hash_value{ hash_of(key) };
+			int8_t tag{ h2(hash_value) };
+			size_t position{ (hash_value >> 7) & mask() };
+
+			for (size_t step{ hash_group::width };; step += hash_group::width) {
+				hash_group group{ _ctrl.data() + position };
+
+				for (uint32_t matches{ group.match(tag) }; matches; matches &= matches - 1) {
+					size_t _index{ (position + std::countr_zero(matches)) & mask() };
+					if (_equal(_nodes[_slots[_index]].first, key)) {
+						return _index;
+					}
+				}
+
+				if (group.match_empty()) {
+					return empty_index;
+				}
+
+				position = (position + step) & mask();
+			}
+		}
+
+		size_t probe_length(const key_type& key) const {
+			size_t hash_value{ hash_of(key) };
+			size_t position{ (hash_value >> 7) & mask() };
+			size_t target{ find_index(key) };
 
-			if (full_index(hash_value) && _equal(_nodes[_indices[hash_value]._index].first, key)) {
-				return hash_value;
+			size_t out{};
+			for (size_t step{ hash_group::width }; ((target - position) & mask()) >= hash_group::width; step += hash_group::width) {
+				position = (position + step) & mask();
+				++out;
 			}
+			return out;
+		}
+
+		size_t find_free_index(size_t hash_value) const {
+			size_t position{ (hash_value >> 7) & mask() };
 
-			for (size_t attempt{ 1 }; attempt < _indices.size(); ++attempt) {
-				hash_value = _probe(primary_hash, attempt) % _indices.size();
-				if (full_index(hash_value) && _equal(_nodes[_indices[hash_value]._index].first, key)) {
-					return hash_value;
+			for (size_t step{ hash_group::width };; step += hash_group::width) {
+				uint32_t free_mask{ hash_group{ _ctrl.data() + position }.match_empty_or_deleted() };
+				if (free_mask) {
+					return (position + std::countr_zero(free_mask)) & mask();
 				}
+
+				position = (position + step) & mask();
 			}
+		}
 
-			return empty_index;
+		void resize_table(size_t new_capacity) {
+			_ctrl.assign(new_capacity + cloned_bytes, hash_group::empty);
+			_slots.assign(new_capacity, 0);
+			_growth_left = new_capacity - new_capacity / 8;
 		}
 
 		void rehash(size_t new_capacity) {
-			index_vector old_indices{ std::move(_indices) };
-			_indices.clear();
-			_indices.resize(new_capacity);
-
-			for (size_t idx{}; idx < old_indices.size(); ++idx) {
-				if (old_indices[idx]._index < deleted_index) {
-					size_t new_index{ find_free_index(old_indices[idx].hash_value) };
-					_indices[new_index] = old_indices[idx];
-				}
+			resize_table(new_capacity);
+
+			for (size_t node_index{}; node_index < _nodes.size(); ++node_index) {
+				size_t hash_value{ hash_of(_nodes[node_index].first) };
+				size_t _index{ find_free_index(hash_value) };
+
+				set_ctrl(_index, h2(hash_value));
+				_slots[_index] = static_cast<uint32_t>(node_index);
+				--_growth_left;
 			}
 		}
 	};
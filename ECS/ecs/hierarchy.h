@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+namespace Byte {
+
+	template<typename EntityID>
+	struct _Parent {
+		EntityID id{};
+	};
+
+	template<typename EntityID>
+	struct _Children {
+		std::vector<EntityID> ids;
+	};
+
+	template<typename WorldType>
+	class Hierarchy {
+	public:
+		using World = WorldType;
+		using EntityID = typename World::EntityID;
+		using Parent = _Parent<EntityID>;
+		using Children = _Children<EntityID>;
+
+		inline static constexpr uint32_t NONE{ std::numeric_limits<uint32_t>::max() };
+
+		struct Node {
+			EntityID id{};
+			uint32_t parent{ NONE };
+		};
+
+		struct Tree {
+			size_t first{};
+			size_t count{};
+		};
+
+		using NodeVector = std::vector<Node>;
+		using TreeVector = std::vector<Tree>;
+
+	private:
+		World* _world;
+		NodeVector _nodes;
+		TreeVector _trees;
+		bool _dirty{ true };
+
+	public:
+		Hierarchy(World& world)
+			: _world{ &world } {
+		}
+
+		Hierarchy(const Hierarchy& left) = delete;
+
+		Hierarchy(Hierarchy&& right) = delete;
+
+		Hierarchy& operator=(const Hierarchy& left) = delete;
+
+		Hierarchy& operator=(Hierarchy&& right) = delete;
+
+		void attach(EntityID child, EntityID parent) {
+			for (EntityID current{ parent }; current; current = this->parent(current)) {
+				if (current == child) {
+					throw std::runtime_error("Entity can not be parented to its own descendant");
+				}
+			}
+
+			detach(child);
+
+			_world->attach(child, Parent{ parent });
+			if (_world->template has<Children>(parent)) {
+				_world->template get<Children>(parent).ids.push_back(child);
+			}
+			else {
+				_world->attach(parent, Children{ { child } });
+			}
+
+			_dirty = true;
+		}
+
+		void detach(EntityID child) {
+			if (!_world->template has<Parent>(child)) {
+				return;
+			}
+
+			EntityID parent{ _world->template get<Parent>(child).id };
+			_world->template detach<Parent>(child);
+
+			if (_world->contains(parent) && _world->template has<Children>(parent)) {
+				std::vector<EntityID>& ids{ _world->template get<Children>(parent).ids };
+				ids.erase(std::remove(ids.begin(), ids.end(), child), ids.end());
+
+				if (ids.empty()) {
+					_world->template detach<Children>(parent);
+				}
+			}
+
+			_dirty = true;
+		}
+
+		void destroy(EntityID id) {
+			if (_world->template has<Children>(id)) {
+				std::vector<EntityID> ids{ std::move(_world->template get<Children>(id).ids) };
+				_world->template detach<Children>(id);
+
+				for (EntityID child : ids) {
+					if (_world->contains(child)) {
+						destroy(child);
+					}
+				}
+			}
+
+			detach(id);
+			_world->destroy(id);
+			_dirty = true;
+		}
+
+		EntityID parent(EntityID id) {
+			if (_world->template has<Parent>(id)) {
+				return _world->template get<Parent>(id).id;
+			}
+			return EntityID{};
+		}
+
+		const NodeVector& nodes() {
+			rebuild();
+			return _nodes;
+		}
+
+		const TreeVector& trees() {
+			rebuild();
+			return _trees;
+		}
+
+		bool dirty() const {
+			return _dirty;
+		}
+
+	private:
+		void rebuild() {
+			if (!_dirty) {
+				return;
+			}
+
+			_nodes.clear();
+			_trees.clear();
+
+			const World& world{ *_world };
+			for (auto [id, children] : _world->template components<const EntityID, const Children>().template exclude<Parent>()) {
+				Tree tree{ _nodes.size() };
+				_nodes.push_back(Node{ id });
+
+				for (size_t _index{ tree.first }; _index < _nodes.size(); ++_index) {
+					EntityID current{ _nodes[_index].id };
+					if (!_world->template has<Children>(current)) {
+						continue;
+					}
+
+					for (EntityID child : world.template get<Children>(current).ids) {
+						if (_world->contains(child)) {
+							_nodes.push_back(Node{ child, static_cast<uint32_t>(_index) });
+						}
+					}
+				}
+
+				tree.count = _nodes.size() - tree.first;
+				_trees.push_back(tree);
+			}
+
+			_dirty = false;
+		}
+
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace Byte {
+
+	class MappedFile {
+	private:
+		const std::byte* _data{ nullptr };
+		size_t _size{};
+
+#ifdef _WIN32
+		HANDLE _file{ INVALID_HANDLE_VALUE };
+		HANDLE _mapping{ nullptr };
+#endif
+
+	public:
+		MappedFile(const std::string& path) {
+#ifdef _WIN32
+			_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (_file == INVALID_HANDLE_VALUE) {
+				throw std::runtime_error("Failed to open file: " + path);
+			}
+
+			LARGE_INTEGER fileSize;
+			GetFileSizeEx(_file, &fileSize);
+			_size = static_cast<size_t>(fileSize.QuadPart);
+
+			if (_size) {
+				_mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (_mapping) {
+					_data = static_cast<const std::byte*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+				}
+
+				if (!_data) {
+					release();
+					throw std::runtime_error("Failed to map file: " + path);
+				}
+			}
+#else
+			int file{ ::open(path.c_str(), O_RDONLY) };
+			if (file < 0) {
+				throw std::runtime_error("Failed to open file: " + path);
+			}
+
+			struct stat info {};
+			::fstat(file, &info);
+			_size = static_cast<size_t>(info.st_size);
+
+			if (_size) {
+				void* data{ ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0) };
+				if (data == MAP_FAILED) {
+					::close(file);
+					throw std::runtime_error("Failed to map file: " + path);
+				}
+				_data = static_cast<const std::byte*>(data);
+			}
+
+			::close(file);
+#endif
+		}
+
+		MappedFile(const MappedFile& left) = delete;
+
+		MappedFile(MappedFile&& right) = delete;
+
+		MappedFile& operator=(const MappedFile& left) = delete;
+
+		MappedFile& operator=(MappedFile&& right) = delete;
+
+		~MappedFile() {
+			release();
+		}
+
+		const std::byte* data() const {
+			return _data;
+		}
+
+		size_t size() const {
+			return _size;
+		}
+
+	private:
+		void release() {
+#ifdef _WIN32
+			if (_data) {
+				UnmapViewOfFile(_data);
+			}
+			if (_mapping) {
+				CloseHandle(_mapping);
+			}
+			if (_file != INVALID_HANDLE_VALUE) {
+				CloseHandle(_file);
+			}
+#else
+			if (_data) {
+				::munmap(const_cast<std::byte*>(_data), _size);
+			}
+#endif
+			_data = nullptr;
+		}
+	};
+
+}
\ No newline at end of file
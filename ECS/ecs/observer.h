@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <utility>
+#include <functional>
+
+namespace Byte {
+
+	enum class ObserverEvent : uint8_t {
+		ADD,
+		REMOVE,
+		CHANGE
+	};
+
+	template<typename WorldType>
+	class Observer {
+	public:
+		using World = WorldType;
+		using EntityID = typename World::EntityID;
+		using IDVector = std::vector<EntityID>;
+		using Callback = std::function<void(World&, const IDVector&)>;
+		using SeenMap = typename World::EntityIDGenerator::template Map<bool>;
+
+	private:
+		struct Channel {
+			IDVector pending;
+			IDVector batch;
+			std::vector<Callback> callbacks;
+		};
+
+		std::array<Channel, 3> _channels;
+
+	public:
+		void listen(ObserverEvent event, Callback callback) {
+			channel(event).callbacks.push_back(std::move(callback));
+		}
+
+		bool listens(ObserverEvent event) const {
+			return !_channels[static_cast<size_t>(event)].callbacks.empty();
+		}
+
+		void push(ObserverEvent event, EntityID id) {
+			if (listens(event)) {
+				channel(event).pending.push_back(id);
+			}
+		}
+
+		void push(ObserverEvent event, const EntityID* ids, size_t count) {
+			if (listens(event)) {
+				IDVector& pending{ channel(event).pending };
+				pending.insert(pending.end(), ids, ids + count);
+			}
+		}
+
+		size_t pending(ObserverEvent event) const {
+			return _channels[static_cast<size_t>(event)].pending.size();
+		}
+
+		void dispatch(World& world) {
+			for (size_t event{}; event < _channels.size(); ++event) {
+				Channel& channel{ _channels[event] };
+				if (channel.pending.empty()) {
+					continue;
+				}
+
+				channel.batch.swap(channel.pending);
+				channel.pending.clear();
+				settle(world, static_cast<ObserverEvent>(event), channel.batch);
+				if (channel.batch.empty()) {
+					continue;
+				}
+
+				for (size_t _index{}; _index < channel.callbacks.size(); ++_index) {
+					channel.callbacks[_index](world, channel.batch);
+				}
+				channel.batch.clear();
+			}
+		}
+
+	private:
+		// Each id appears once per batch, in the order of its first event. Added or
+		// changed entities destroyed before the flush are dropped.
+		static void settle(World& world, ObserverEvent event, IDVector& batch) {
+			bool live{ event != ObserverEvent::REMOVE };
+			bool repeats{ batch.size() > 1 };
+			SeenMap seen;
+			if (repeats) {
+				seen.reserve(batch.size());
+			}
+
+			size_t count{};
+			for (size_t _index{}; _index < batch.size(); ++_index) {
+				EntityID id{ batch[_index] };
+				if (live && !world.contains(id)) {
+					continue;
+				}
+
+				if (repeats) {
+					if (seen.contains(id)) {
+						continue;
+					}
+					seen.emplace(id, true);
+				}
+				batch[count++] = id;
+			}
+			batch.resize(count);
+		}
+
+		Channel& channel(ObserverEvent event) {
+			return _channels[static_cast<size_t>(event)];
+		}
+
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <unordered_map>
+
+#include "component.h"
+#include "sparse_set.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	class Prefab {
+	public:
+		using World = WorldType;
+		using Archetype = typename World::Archetype;
+		using EntityID = typename World::EntityID;
+		using EntityData = typename World::EntityData;
+		using IDContainer = std::vector<EntityID>;
+
+	private:
+		using USparseSet = std::unique_ptr<ISparseSet<EntityID>>;
+		using SparseMap = std::unordered_map<ComponentID, USparseSet>;
+
+		Archetype _template;
+		SparseMap _sparse;
+		EntityID _source{};
+		size_t _componentCount{};
+
+	public:
+		Prefab(World& world, EntityID source)
+			: _source{ source } {
+			EntityData& data{ world._entities.at(source) };
+			if (data.arche) {
+				_template = Archetype::template build<>(*data.arche);
+				_template.copyEntity(data._index, source, *data.arche);
+				_componentCount = _template.memory().size() - 1;
+			}
+			else {
+				_template.pushEntity(source);
+			}
+
+			for (auto& pair : world._sparse) {
+				if (pair.second->contains(source)) {
+					_sparse.emplace(pair.first, pair.second->snapshot(source));
+				}
+			}
+		}
+
+		EntityID instantiate(World& world) {
+			return instantiate(world, 1).front();
+		}
+
+		IDContainer instantiate(World& world, size_t count) {
+			IDContainer out(count);
+			if (count == 0) {
+				return out;
+			}
+
+			world._entities.reserve(world._entities.size() + count);
+			World::EntityIDGenerator::generate(world._entities, out.data(), count);
+
+			Archetype* dest{ world.template attachArche<>(&_template) };
+			size_t first{ dest->pushEntities(out.data(), count) };
+			dest->fillRows(first, count, _template, 0);
+			dest->touchRows(first, count, world._tick);
+			world.observeMove(nullptr, dest, out.data(), count);
+
+			for (size_t _index{}; _index < count; ++_index) {
+				world._entities.emplace(out[_index], EntityData{ first + _index, dest });
+			}
+
+			for (auto& pair : _sparse) {
+				typename World::USparseSet& set{ world._sparse[pair.first] };
+				if (!set) {
+					set = pair.second->create();
+				}
+				set->fill(*pair.second, _source, out.data(), count);
+				world.observe(ObserverEvent::ADD, pair.first, out.data(), count);
+			}
+
+			world._counters.creates += count;
+			world._counters.attaches += count * (_componentCount + _sparse.size());
+
+			return out;
+		}
+
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "component.h"
+#include "sparse_set.h"
+
+namespace Byte {
+
+	template<typename _Kind, typename _Target>
+	struct Relation {
+		using Kind = _Kind;
+		using Target = _Target;
+
+		Target target{};
+	};
+
+	template<typename Kind, typename Target>
+	struct ComponentStorage<Relation<Kind, Target>> {
+		inline static constexpr bool SPARSE{ true };
+	};
+
+	template<typename EntityID, typename Kind, typename Target>
+	class SparseIndex<EntityID, Relation<Kind, Target>> {
+	public:
+		using IDVector = std::vector<EntityID>;
+		using SourceMap = std::unordered_map<Target, IDVector>;
+
+		struct Position {
+			Target target{};
+			size_t _index{};
+		};
+
+		using PositionMap = std::unordered_map<EntityID, Position>;
+
+	private:
+		SourceMap _sources;
+		PositionMap _positions;
+
+	public:
+		void insert(EntityID id, const Relation<Kind, Target>& relation) {
+			IDVector& ids{ _sources[relation.target] };
+			_positions[id] = Position{ relation.target, ids.size() };
+			ids.push_back(id);
+		}
+
+		void erase(EntityID id, const Relation<Kind, Target>&) {
+			auto position{ _positions.find(id) };
+			if (position == _positions.end()) {
+				return;
+			}
+
+			auto result{ _sources.find(position->second.target) };
+			if (result != _sources.end()) {
+				IDVector& ids{ result->second };
+
+				size_t _index{ position->second._index };
+				if (_index != ids.size() - 1) {
+					ids[_index] = ids.back();
+					_positions.at(ids[_index])._index = _index;
+				}
+
+				ids.pop_back();
+				if (ids.empty()) {
+					_sources.erase(result);
+				}
+			}
+
+			_positions.erase(position);
+		}
+
+		void clear() {
+			_sources.clear();
+			_positions.clear();
+		}
+
+		const IDVector& sources(const Target& target) const {
+			static const IDVector empty;
+
+			auto result{ _sources.find(target) };
+			return result != _sources.end() ? result->second : empty;
+		}
+
+		size_t targetCount() const {
+			return _sources.size();
+		}
+	};
+
+}
\ No newline at end of file
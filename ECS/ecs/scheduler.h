@@ -0,0 +1,140 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include "thread_pool.h"
+
+namespace Byte {
+
+	template<typename... Components>
+	struct Read {
+		template<typename Signature>
+		static Signature signature() {
+			return Signature::template build<Components...>();
+		}
+
+		template<typename World>
+		static void prepare(World& world) {
+			world.template prepare<const Components...>();
+		}
+	};
+
+	template<typename... Components>
+	struct Write {
+		template<typename Signature>
+		static Signature signature() {
+			return Signature::template build<Components...>();
+		}
+
+		template<typename World>
+		static void prepare(World& world) {
+			world.template prepare<Components...>();
+		}
+	};
+
+	template<typename WorldType>
+	class Scheduler {
+	public:
+		using World = WorldType;
+		using Signature = typename World::Signature;
+		using Function = std::function<void(World&, ThreadPool&)>;
+		using Prepare = void (*)(World&);
+
+	private:
+		struct System {
+			Function function;
+			Prepare prepare{ nullptr };
+			Signature reads;
+			Signature writes;
+		};
+
+		using SystemVector = std::vector<System>;
+		using Stage = std::vector<size_t>;
+		using StageVector = std::vector<Stage>;
+
+		SystemVector _systems;
+		StageVector _stages;
+		ThreadPool _pool;
+
+	public:
+		Scheduler(size_t threadCount = ThreadPool::defaultThreadCount())
+			: _pool{ threadCount } {
+		}
+
+		template<typename ReadAccess, typename WriteAccess = Write<>, typename _Function>
+		void system(_Function&& function) {
+			System system{
+				Function{ std::forward<_Function>(function) },
+				[](World& world) {
+					ReadAccess::prepare(world);
+					WriteAccess::prepare(world);
+				},
+				ReadAccess::template signature<Signature>(),
+				WriteAccess::template signature<Signature>() };
+
+			size_t stage{};
+			for (size_t _index{}; _index < _stages.size(); ++_index) {
+				for (size_t other : _stages[_index]) {
+					if (conflicts(system, _systems[other])) {
+						stage = _index + 1;
+					}
+				}
+			}
+
+			if (stage == _stages.size()) {
+				_stages.emplace_back();
+			}
+
+			_stages[stage].push_back(_systems.size());
+			_systems.push_back(std::move(system));
+		}
+
+		void run(World& world) {
+			for (const Stage& stage : _stages) {
+				for (size_t system : stage) {
+					_systems[system].prepare(world);
+				}
+
+				if (stage.size() == 1) {
+					_systems[stage.front()].function(world, _pool);
+					continue;
+				}
+
+				ThreadPool::TaskGroup group;
+				for (size_t system : stage) {
+					_pool.submit(group, [this, &world, system]() {
+						_systems[system].function(world, _pool);
+					});
+				}
+				_pool.wait(group);
+			}
+		}
+
+		size_t size() const {
+			return _systems.size();
+		}
+
+		size_t stageCount() const {
+			return _stages.size();
+		}
+
+		ThreadPool& pool() {
+			return _pool;
+		}
+
+		void clear() {
+			_systems.clear();
+			_stages.clear();
+		}
+
+	private:
+		static bool conflicts(const System& left, const System& right) {
+			return left.writes.matches(right.reads + right.writes) || right.writes.matches(left.reads);
+		}
+
+	};
+
+}
\ No newline at end of file
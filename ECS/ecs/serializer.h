@@ -0,0 +1,394 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <memory>
+#include <fstream>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+
+#include "chunk.h"
+#include "component.h"
+#include "mapped_file.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	class Serializer {
+	public:
+		using World = WorldType;
+		using Archetype = typename World::Archetype;
+		using EntityID = typename World::EntityID;
+		using EntityData = typename World::EntityData;
+		using Signature = typename World::Signature;
+
+		inline static constexpr uint32_t MAGIC{ 0x57545942 };
+		inline static constexpr uint32_t VERSION{ 1 };
+		inline static constexpr size_t ALIGNMENT{ Chunk::ALIGNMENT };
+
+		inline static constexpr bool CHUNKED{
+			std::is_same_v<typename World::template Container<EntityID>, chunk_storage<EntityID>> };
+
+	private:
+		struct FileHeader {
+			uint32_t magic{};
+			uint32_t version{};
+			uint32_t componentCount{};
+			uint32_t archetypeCount{};
+			uint64_t tick{};
+			uint64_t looseCount{};
+		};
+
+		struct ArchetypeHeader {
+			uint64_t size{};
+			uint64_t chunkCapacity{};
+			uint64_t chunkStride{};
+			uint32_t columnCount{};
+			uint32_t padding{};
+		};
+
+		struct ColumnHeader {
+			uint32_t component{};
+			uint32_t size{};
+			uint64_t offset{};
+		};
+
+		using ColumnVector = std::vector<ColumnHeader>;
+
+		class Writer {
+		private:
+			std::ofstream _stream;
+			size_t _position{};
+
+		public:
+			Writer(const std::string& path)
+				: _stream{ path, std::ios::binary | std::ios::trunc } {
+				if (!_stream) {
+					throw std::runtime_error("Failed to open file: " + path);
+				}
+			}
+
+			void write(const void* data, size_t bytes) {
+				_stream.write(static_cast<const char*>(data), bytes);
+				_position += bytes;
+
+				if (!_stream) {
+					throw std::runtime_error("Failed to write world file");
+				}
+			}
+
+			template<typename Type>
+			void write(const Type& value) {
+				write(&value, sizeof(Type));
+			}
+
+			void pad(size_t alignment) {
+				static constexpr char zeros[ALIGNMENT]{};
+				write(zeros, Chunk::align(_position, alignment) - _position);
+			}
+		};
+
+		class Reader {
+		private:
+			const std::byte* _data;
+			size_t _size;
+			size_t _position{};
+
+		public:
+			Reader(const std::byte* data, size_t size)
+				: _data{ data }, _size{ size } {
+			}
+
+			const std::byte* read(size_t bytes) {
+				if (bytes > _size - _position) {
+					throw std::runtime_error("Corrupted world file");
+				}
+
+				const std::byte* out{ _data + _position };
+				_position += bytes;
+				return out;
+			}
+
+			template<typename Type>
+			Type read() {
+				Type out;
+				std::memcpy(&out, read(sizeof(Type)), sizeof(Type));
+				return out;
+			}
+
+			size_t remaining() const {
+				return _size - _position;
+			}
+
+			void align(size_t alignment) {
+				read(Chunk::align(_position, alignment) - _position);
+			}
+		};
+
+	public:
+		template<typename... Components>
+		static void save(World& world, const std::string& path) {
+			static_assert((std::is_trivially_copyable_v<Components> && ...),
+				"Serialized components must be trivially copyable");
+
+			Signature serializable{ Signature::template build<EntityID, Components...>() };
+
+			std::vector<Archetype*> arches;
+			std::vector<EntityID> loose;
+
+			for (auto& pair : world._sparse) {
+				if (pair.second->size()) {
+					throw std::runtime_error("World contains sparse components that are not serialized");
+				}
+			}
+
+			for (auto& pair : world._arches) {
+				if (pair.second.empty()) {
+					continue;
+				}
+
+				if (!serializable.includes(pair.second.signature())) {
+					throw std::runtime_error("World contains components that are not serialized");
+				}
+				arches.push_back(&pair.second);
+			}
+
+			for (auto& pair : world._entities) {
+				if (!pair.second.arche) {
+					loose.push_back(pair.first);
+				}
+			}
+
+			Writer writer{ path };
+			writer.write(FileHeader{
+				MAGIC,
+				VERSION,
+				static_cast<uint32_t>(sizeof...(Components) + 1),
+				static_cast<uint32_t>(arches.size()),
+				world._tick,
+				loose.size() });
+
+			uint32_t sizes[]{ sizeof(EntityID), sizeof(Components)... };
+			writer.write(sizes, sizeof(sizes));
+			writer.write(loose.data(), loose.size() * sizeof(EntityID));
+
+			for (Archetype* arche : arches) {
+				saveArchetype<EntityID, Components...>(writer, *arche);
+			}
+		}
+
+		template<typename... Components>
+		static World load(const std::string& path) {
+			static_assert((std::is_trivially_copyable_v<Components> && ...),
+				"Serialized components must be trivially copyable");
+
+			std::shared_ptr<MappedFile> file{ std::make_shared<MappedFile>(path) };
+			Reader reader{ file->data(), file->size() };
+
+			FileHeader header{ reader.template read<FileHeader>() };
+			if (header.magic != MAGIC || header.version != VERSION) {
+				throw std::runtime_error("Unsupported world file");
+			}
+
+			uint32_t sizes[]{ sizeof(EntityID), sizeof(Components)... };
+			if (header.componentCount != sizeof...(Components) + 1
+				|| std::memcmp(reader.read(sizeof(sizes)), sizes, sizeof(sizes)) != 0) {
+				throw std::runtime_error("World file component layout mismatch");
+			}
+
+			World out;
+			out._tick = header.tick;
+
+			const std::byte* loose{ reader.read(header.looseCount * sizeof(EntityID)) };
+			for (size_t _index{}; _index < header.looseCount; ++_index) {
+				EntityID id;
+				std::memcpy(&id, loose + _index * sizeof(EntityID), sizeof(EntityID));
+				out._entities.emplace(id, EntityData{});
+			}
+
+			for (size_t _index{}; _index < header.archetypeCount; ++_index) {
+				loadArchetype<EntityID, Components...>(reader, file, out);
+			}
+
+			return out;
+		}
+
+	private:
+		template<typename... Components>
+		static void saveArchetype(Writer& writer, Archetype& arche) {
+			ArchetypeHeader header{ arche.size(), arche.chunkCapacity() };
+			ColumnVector columns;
+
+			uint32_t component{};
+			(pushColumn<Components>(arche, columns, component++), ...);
+
+			size_t chunkBytes{};
+			if constexpr (CHUNKED) {
+				chunkBytes = arche.chunkBytes();
+			}
+			else {
+				for (ColumnHeader& column : columns) {
+					column.offset = Chunk::align(chunkBytes, ALIGNMENT);
+					chunkBytes = column.offset + column.size * header.chunkCapacity;
+				}
+			}
+
+			header.chunkStride = Chunk::align(chunkBytes, ALIGNMENT);
+			header.columnCount = static_cast<uint32_t>(columns.size());
+
+			writer.write(header);
+			writer.write(columns.data(), columns.size() * sizeof(ColumnHeader));
+			writer.pad(ALIGNMENT);
+
+			std::vector<std::byte> image(header.chunkStride);
+			for (size_t chunk{}; chunk < arche.chunkCount(); ++chunk) {
+				std::fill(image.begin(), image.end(), std::byte{});
+
+				size_t rows{ arche.chunkSize(chunk) };
+				size_t column{};
+				(copyColumn<Components>(arche, columns, column, chunk, rows, image.data()), ...);
+
+				writer.write(image.data(), image.size());
+			}
+		}
+
+		template<typename... Components>
+		static void loadArchetype(Reader& reader, const std::shared_ptr<MappedFile>& file, World& world) {
+			ArchetypeHeader header{ reader.template read<ArchetypeHeader>() };
+			if (header.chunkCapacity == 0
+				|| header.size > reader.remaining()
+				|| header.chunkStride > reader.remaining()
+				|| header.columnCount > sizeof...(Components)) {
+				throw std::runtime_error("Corrupted world file");
+			}
+
+			ColumnVector columns(header.columnCount);
+			std::memcpy(columns.data(), reader.read(columns.size() * sizeof(ColumnHeader)), columns.size() * sizeof(ColumnHeader));
+			reader.align(ALIGNMENT);
+
+			size_t chunkCount{ (header.size + header.chunkCapacity - 1) / header.chunkCapacity };
+			const std::byte* data{ reader.read(chunkCount * header.chunkStride) };
+
+			Archetype build;
+			for (const ColumnHeader& column : columns) {
+				if (column.component >= sizeof...(Components) || column.offset + column.size * header.chunkCapacity > header.chunkStride) {
+					throw std::runtime_error("Corrupted world file");
+				}
+
+				uint32_t component{};
+				((column.component == component++ ? build.template emplaceAccessor<Components>() : void()), ...);
+			}
+
+			Signature signature{ build.signature() };
+			Archetype* arche{ world.emplaceArche(signature, std::move(build)) };
+			const ColumnHeader* entities{ find(columns, 0) };
+			if (!entities) {
+				throw std::runtime_error("Corrupted world file");
+			}
+
+			if (adoptable<Components...>(*arche, header, columns)) {
+				if constexpr (CHUNKED) {
+					typename Archetype::ChunkVector chunks;
+					chunks.reserve(chunkCount);
+					for (size_t chunk{}; chunk < chunkCount; ++chunk) {
+						std::byte* image{ const_cast<std::byte*>(data + chunk * header.chunkStride) };
+						chunks.emplace_back(std::shared_ptr<std::byte>{ file, image }, arche->chunkBytes());
+					}
+					arche->adoptChunks(std::move(chunks), header.size);
+				}
+			}
+			else {
+				for (size_t chunk{}; chunk < chunkCount; ++chunk) {
+					const std::byte* image{ data + chunk * header.chunkStride };
+					size_t rows{ std::min<size_t>(header.chunkCapacity, header.size - chunk * header.chunkCapacity) };
+					size_t first{ arche->pushEntities(reinterpret_cast<const EntityID*>(image + entities->offset), rows) };
+
+					uint32_t component{};
+					(placeColumn<Components>(*arche, columns, component++, first, rows, image), ...);
+				}
+			}
+
+			arche->touchRows(0, arche->size(), world._tick);
+
+			world._entities.reserve(world._entities.size() + header.size);
+			for (size_t row{}; row < header.size; ++row) {
+				size_t chunk{ row / header.chunkCapacity };
+				const std::byte* id{ data + chunk * header.chunkStride + entities->offset + (row % header.chunkCapacity) * sizeof(EntityID) };
+
+				EntityID entity;
+				std::memcpy(&entity, id, sizeof(EntityID));
+				world._entities.emplace(entity, EntityData{ row, arche });
+			}
+		}
+
+		template<typename Component>
+		static void pushColumn(Archetype& arche, ColumnVector& columns, uint32_t component) {
+			ComponentID id{ World::template componentID<Component>() };
+			if (!arche.signature().test(id)) {
+				return;
+			}
+
+			ColumnHeader column{ component, sizeof(Component) };
+			if constexpr (CHUNKED) {
+				column.offset = arche.columnOffset(id);
+			}
+			columns.push_back(column);
+		}
+
+		template<typename Component>
+		static void copyColumn(Archetype& arche, const ColumnVector& columns, size_t& column, size_t chunk, size_t rows, std::byte* image) {
+			if (!arche.signature().test(World::template componentID<Component>())) {
+				return;
+			}
+
+			std::memcpy(image + columns[column++].offset, arche.template chunkData<const Component>(chunk), rows * sizeof(Component));
+		}
+
+		template<typename Component>
+		static void placeColumn(Archetype& arche, const ColumnVector& columns, uint32_t component, size_t first, size_t rows, const std::byte* image) {
+			const ColumnHeader* column{ find(columns, component) };
+			if (component == 0 || !column) {
+				return;
+			}
+
+			arche.template placeComponents<Component>(first, reinterpret_cast<const Component*>(image + column->offset), rows);
+		}
+
+		template<typename... Components>
+		static bool adoptable(Archetype& arche, const ArchetypeHeader& header, const ColumnVector& columns) {
+			if constexpr (CHUNKED) {
+				if (header.chunkCapacity != arche.chunkCapacity() || header.chunkStride < arche.chunkBytes()) {
+					return false;
+				}
+
+				bool out{ true };
+				uint32_t component{};
+				((out = out && matchesColumn<Components>(arche, columns, component++)), ...);
+				return out;
+			}
+			else {
+				return false;
+			}
+		}
+
+		template<typename Component>
+		static bool matchesColumn(Archetype& arche, const ColumnVector& columns, uint32_t component) {
+			const ColumnHeader* column{ find(columns, component) };
+			return !column || column->offset == arche.columnOffset(World::template componentID<Component>());
+		}
+
+		static const ColumnHeader* find(const ColumnVector& columns, uint32_t component) {
+			for (const ColumnHeader& column : columns) {
+				if (column.component == component) {
+					return &column;
+				}
+			}
+			return nullptr;
+		}
+
+	};
+
+}
\ No newline at end of file
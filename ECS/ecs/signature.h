@@ -1,36 +1,50 @@
 #pragma once
 
-#include <bitset>
 #include <array>
 #include <cstdint>
+#include <type_traits>
 
 #include "component.h"
 
 namespace Byte {
 
-	template<size_t _MAX_COMPONENT_COUNT>
+	template<typename Signature, typename... Components>
+	struct StaticSignature {
+		inline static constexpr Signature value{ Signature::template compile<Components...>() };
+	};
+
+	template<size_t _MAX_COMPONENT_COUNT, typename _ComponentList = ComponentList<>>
 	class Signature {
 	public:
 		inline static constexpr size_t MAX_COMPONENT_COUNT{ _MAX_COMPONENT_COUNT };
 		inline static constexpr size_t BITSET_SIZE{ 64 };
 		inline static constexpr size_t BITSET_COUNT{ (MAX_COMPONENT_COUNT + BITSET_SIZE - 1) / BITSET_SIZE };
 
-		using Bitset = std::bitset<BITSET_SIZE>;
+		using ComponentList = _ComponentList;
+		using Bitset = uint64_t;
 		using BitsetArray = std::array<Bitset, BITSET_COUNT>;
 
 	private:
-		BitsetArray _bitsets;
+		BitsetArray _bitsets{};
 
 	public:
-		void set(ComponentID id, bool value = true) {
-			_bitsets[id / BITSET_SIZE].set(id % BITSET_SIZE, value);
+		constexpr Signature() = default;
+
+		constexpr void set(ComponentID id, bool value = true) {
+			Bitset mask{ Bitset{ 1 } << (id % BITSET_SIZE) };
+			if (value) {
+				_bitsets[id / BITSET_SIZE] |= mask;
+			}
+			else {
+				_bitsets[id / BITSET_SIZE] &= ~mask;
+			}
 		}
 
-		bool test(ComponentID id) const {
-			return _bitsets[id / BITSET_SIZE].test(id % BITSET_SIZE);
+		constexpr bool test(ComponentID id) const {
+			return (_bitsets[id / BITSET_SIZE] >> (id % BITSET_SIZE)) & 1;
 		}
 
-		bool includes(const Signature& signature) const {
+		constexpr bool includes(const Signature& signature) const {
 			for (size_t _index{}; _index < BITSET_COUNT; ++_index) {
 				if ((_bitsets[_index] | signature._bitsets[_index]) != _bitsets[_index]) {
 					return false;
@@ -39,25 +53,25 @@ namespace Byte {
 			return true;
 		}
 
-		bool matches(const Signature& signature) const {
+		constexpr bool matches(const Signature& signature) const {
 			for (size_t _index{}; _index < BITSET_COUNT; ++_index) {
-				if ((_bitsets[_index] & signature._bitsets[_index]).any()) {
+				if (_bitsets[_index] & signature._bitsets[_index]) {
 					return true;
 				}
 			}
 			return false;
 		}
 
-		bool any() const {
+		constexpr bool any() const {
 			for (Bitset bitset: _bitsets) {
-				if (bitset.any()) {
+				if (bitset) {
 					return true;
 				}
 			}
 			return false;
 		}
 
-		bool operator==(const Signature& other) const {
+		constexpr bool operator==(const Signature& other) const {
 			for (size_t _index{}; _index < BITSET_COUNT; ++_index) {
 				if (_bitsets[_index] != other._bitsets[_index]) {
 					return false;
@@ -66,11 +80,11 @@ namespace Byte {
 			return true;
 		}
 
-		bool operator!=(const Signature& other) const {
+		constexpr bool operator!=(const Signature& other) const {
 			return !(*this == other);
 		}
 
-		Signature operator+(const Signature& other) const {
+		constexpr Signature operator+(const Signature& other) const {
 			Signature out;
 			for (size_t i{}; i < BITSET_COUNT; ++i) {
 				out._bitsets[i] = _bitsets[i] | other._bitsets[i];
@@ -78,21 +92,38 @@ namespace Byte {
 			return out;
 		}
 
-		Signature& operator+=(const Signature& other) {
+		constexpr Signature& operator+=(const Signature& other) {
 			for (size_t i{}; i < BITSET_COUNT; ++i) {
 				_bitsets[i] |= other._bitsets[i];
 			}
 			return *this;
 		}
 
-		const BitsetArray& data() const {
+		constexpr const BitsetArray& data() const {
 			return _bitsets;
 		}
 
 		template<typename... Components>
 		static Signature build() {
+			if constexpr ((ComponentList::template CONTAINS<std::decay_t<Components>> && ...)) {
+				return StaticSignature<Signature, std::decay_t<Components>...>::value;
+			}
+			else {
+				Signature out;
+				(out.set(ComponentList::template id<std::decay_t<Components>>()), ...);
+				return out;
+			}
+		}
+
+		template<typename... Components>
+		static constexpr Signature compile() {
+			static_assert((ComponentList::template CONTAINS<std::decay_t<Components>> && ...),
+				"Compile time signatures require every component to be declared in the component list.");
+			static_assert(ComponentList::SIZE <= MAX_COMPONENT_COUNT,
+				"Component list exceeds the maximum component count.");
+
 			Signature out;
-			(out.set(Registry<std::decay_t<Components>>::id()), ...);
+			(out.set(ComponentList::template index<std::decay_t<Components>>()), ...);
 			return out;
 		}
 
@@ -102,21 +133,20 @@ namespace Byte {
 
 namespace std {
 
-	template<size_t MAX_COMPONENT_COUNT>
-	struct hash<Byte::Signature<MAX_COMPONENT_COUNT>> {
+	template<size_t MAX_COMPONENT_COUNT, typename ComponentList>
+	struct hash<Byte::Signature<MAX_COMPONENT_COUNT, ComponentList>> {
 
-		using Signature = Byte::Signature<MAX_COMPONENT_COUNT>;
+		using Signature = Byte::Signature<MAX_COMPONENT_COUNT, ComponentList>;
 
 		size_t operator()(const Signature& signature) const {
 			size_t result{};
 
 			for (size_t i{}; i < signature.BITSET_COUNT; ++i) {
-				result += signature.data()[i].to_ullong();
+				result += signature.data()[i];
 			}
 
 			return result;
 		}
 	};
 
-}
-
+}
\ No newline at end of file
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <stdexcept>
+#include <iterator>
+#include <atomic>
+#include <array>
+#include <algorithm>
+
+namespace Byte {
+
+	template<typename _Key, typename _Value>
+	class slot_map {
+	public:
+		using key_type = _Key;
+		using value_type = _Value;
+
+		using map_node = std::pair<_Key, _Value>;
+		using probe_histogram = std::array<size_t, 8>;
+
+	private:
+		struct slot {
+			map_node node;
+			bool alive{ false };
+		};
+
+		using slot_vector = std::vector<slot>;
+		using free_vector = std::vector<uint32_t>;
+
+		slot_vector _slots;
+		free_vector _free;
+		size_t _size{};
+		alignas(std::atomic_ref<uint32_t>::required_alignment) uint32_t _next{};
+		alignas(std::atomic_ref<uint32_t>::required_alignment) uint32_t _claimed{};
+
+		template<typename _Slot, typename _Node>
+		class basic_iterator {
+		private:
+			_Slot* _current{ nullptr };
+			_Slot* _end{ nullptr };
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = map_node;
+			using difference_type = std::ptrdiff_t;
+			using pointer = _Node*;
+			using reference = _Node&;
+
+			basic_iterator() = default;
+
+			basic_iterator(_Slot* current, _Slot* end)
+				: _current{ current }, _end{ end } {
+				skip();
+			}
+
+			reference operator*() const {
+				return _current->node;
+			}
+
+			pointer operator->() const {
+				return &_current->node;
+			}
+
+			basic_iterator& operator++() {
+				++_current;
+				skip();
+				return *this;
+			}
+
+			basic_iterator operator++(int) {
+				basic_iterator out{ *this };
+				++(*this);
+				return out;
+			}
+
+			bool operator==(const basic_iterator& other) const {
+				return _current == other._current;
+			}
+
+			bool operator!=(const basic_iterator& other) const {
+				return _current != other._current;
+			}
+
+		private:
+			void skip() {
+				while (_current != _end && !_current->alive) {
+					++_current;
+				}
+			}
+		};
+
+	public:
+		using iterator = basic_iterator<slot, map_node>;
+		using const_iterator = basic_iterator<const slot, const map_node>;
+
+	public:
+		key_type generate() {
+			settle();
+			while (!_free.empty()) {
+				uint32_t _index{ _free.back() };
+				_free.pop_back();
+
+				if (!_slots[_index].alive) {
+					return _slots[_index].node.first;
+				}
+			}
+
+			uint32_t _index{ std::atomic_ref<uint32_t>{ _next }.fetch_add(1, std::memory_order_relaxed) };
+			grow(_index + 1);
+			return _slots[_index].node.first;
+		}
+
+		void generate(key_type* out, size_t count) {
+			settle();
+			size_t reused{};
+			while (reused < count && !_free.empty()) {
+				uint32_t _index{ _free.back() };
+				_free.pop_back();
+
+				if (!_slots[_index].alive) {
+					out[reused++] = _slots[_index].node.first;
+				}
+			}
+
+			size_t remaining{ count - reused };
+			if (remaining == 0) {
+				return;
+			}
+
+			uint32_t first{ std::atomic_ref<uint32_t>{ _next }.fetch_add(static_cast<uint32_t>(remaining), std::memory_order_relaxed) };
+			grow(first + remaining);
+
+			for (size_t _index{}; _index < remaining; ++_index) {
+				out[reused + _index] = key_type{ static_cast<uint32_t>(first + _index), 1 };
+			}
+		}
+
+		key_type reserve_key() {
+			std::atomic_ref<uint32_t> claimed{ _claimed };
+			for (size_t taken{ claimed.fetch_add(1, std::memory_order_relaxed) }; taken < _free.size();
+				taken = claimed.fetch_add(1, std::memory_order_relaxed)) {
+				uint32_t _index{ _free[_free.size() - 1 - taken] };
+				if (!_slots[_index].alive) {
+					return _slots[_index].node.first;
+				}
+			}
+
+			return key_type{ std::atomic_ref<uint32_t>{ _next }.fetch_add(1, std::memory_order_relaxed), 1 };
+		}
+
+		void release_key(const key_type& key) {
+			settle();
+			if (key.index >= _slots.size()) {
+				grow(key.index + 1);
+			}
+
+			slot& target{ _slots[key.index] };
+			if (target.alive || target.node.first.version != key.version) {
+				return;
+			}
+
+			++target.node.first.version;
+			_free.push_back(key.index);
+		}
+
+		value_type& at(const key_type& key) {
+			if (!contains(key)) {
+				throw std::out_of_range("Key not found");
+			}
+
+			return _slots[key.index].node.second;
+		}
+
+		const value_type& at(const key_type& key) const {
+			if (!contains(key)) {
+				throw std::out_of_range("Key not found");
+			}
+
+			return _slots[key.index].node.second;
+		}
+
+		template<typename... _Args>
+		void emplace(const key_type& key, _Args&&... args) {
+			settle();
+			if (key.index >= _slots.size()) {
+				grow(key.index + 1);
+			}
+
+			slot& target{ _slots[key.index] };
+			if (target.alive) {
+				return;
+			}
+
+			target.node.first = key;
+			target.node.second = value_type{ std::forward<_Args>(args)... };
+			target.alive = true;
+			++_size;
+		}
+
+		value_type& operator[](const key_type& key) {
+			if (!contains(key)) {
+				emplace(key);
+			}
+
+			return _slots[key.index].node.second;
+		}
+
+		const value_type& operator[](const key_type& key) const {
+			return at(key);
+		}
+
+		iterator find(const key_type& key) {
+			if (contains(key)) {
+				return iterator{ _slots.data() + key.index, _slots.data() + _slots.size() };
+			}
+			return end();
+		}
+
+		const_iterator find(const key_type& key) const {
+			if (contains(key)) {
+				return const_iterator{ _slots.data() + key.index, _slots.data() + _slots.size() };
+			}
+			return end();
+		}
+
+		bool contains(const key_type& key) const {
+			return key.index < _slots.size()
+				&& _slots[key.index].alive
+				&& _slots[key.index].node.first.version == key.version;
+		}
+
+		void erase(const key_type& key) {
+			if (!contains(key)) {
+				return;
+			}
+
+			settle();
+			slot& target{ _slots[key.index] };
+			target.alive = false;
+			target.node.second = value_type{};
+			++target.node.first.version;
+
+			_free.push_back(key.index);
+			--_size;
+		}
+
+		size_t size() const {
+			return _size;
+		}
+
+		size_t capacity() const {
+			return _slots.capacity();
+		}
+
+		float load_factor() const {
+			return _slots.empty() ? 0.0f : static_cast<float>(_size) / _slots.size();
+		}
+
+		probe_histogram probes() const {
+			probe_histogram out{};
+			out[0] = _size;
+			return out;
+		}
+
+		void reserve(size_t new_capacity) {
+			_slots.reserve(new_capacity);
+		}
+
+		iterator begin() {
+			return iterator{ _slots.data(), _slots.data() + _slots.size() };
+		}
+
+		iterator end() {
+			return iterator{ _slots.data() + _slots.size(), _slots.data() + _slots.size() };
+		}
+
+		const_iterator begin() const {
+			return const_iterator{ _slots.data(), _slots.data() + _slots.size() };
+		}
+
+		const_iterator end() const {
+			return const_iterator{ _slots.data() + _slots.size(), _slots.data() + _slots.size() };
+		}
+
+		void clear() {
+			settle();
+			for (size_t _index{}; _index < _slots.size(); ++_index) {
+				slot& target{ _slots[_index] };
+				if (target.alive) {
+					target.alive = false;
+					target.node.second = value_type{};
+					++target.node.first.version;
+					_free.push_back(static_cast<uint32_t>(_index));
+				}
+			}
+			_size = 0;
+		}
+
+	private:
+		void settle() {
+			_free.resize(_free.size() - std::min<size_t>(_claimed, _free.size()));
+			_claimed = 0;
+		}
+
+		void grow(size_t new_size) {
+			std::atomic_ref<uint32_t> next{ _next };
+			uint32_t reserved{ next.load(std::memory_order_relaxed) };
+
+			while (_slots.size() < new_size) {
+				uint32_t _index{ static_cast<uint32_t>(_slots.size()) };
+				_slots.push_back(slot{ map_node{ key_type{ _index, 1 }, value_type{} } });
+
+				if (_index + 1 < new_size && _index >= reserved) {
+					_free.push_back(_index);
+				}
+			}
+
+			while (reserved < new_size && !next.compare_exchange_weak(reserved, static_cast<uint32_t>(new_size))) {
+			}
+		}
+	};
+
+}
\ No newline at end of file
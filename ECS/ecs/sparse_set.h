@@ -0,0 +1,204 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <utility>
+
+namespace Byte {
+
+	template<typename EntityID, typename Component>
+	class SparseIndex {
+	public:
+		void insert(EntityID, const Component&) {
+		}
+
+		void erase(EntityID, const Component&) {
+		}
+
+		void clear() {
+		}
+	};
+
+	template<typename EntityID>
+	class ISparseSet {
+	public:
+		virtual ~ISparseSet() = default;
+
+		virtual std::unique_ptr<ISparseSet> copy() const = 0;
+
+		virtual void clone(EntityID source, EntityID dest) = 0;
+
+		virtual std::unique_ptr<ISparseSet> snapshot(EntityID id) const = 0;
+
+		virtual std::unique_ptr<ISparseSet> create() const = 0;
+
+		virtual void fill(const ISparseSet& from, EntityID source, const EntityID* ids, size_t count) = 0;
+
+		virtual void erase(EntityID id) = 0;
+
+		virtual bool contains(EntityID id) const = 0;
+
+		virtual size_t size() const = 0;
+
+		virtual size_t bytes() const = 0;
+
+		virtual void trim() = 0;
+
+		virtual void clear() = 0;
+	};
+
+	template<typename EntityID, typename IndexMap, typename Component>
+	class SparseSet : public ISparseSet<EntityID> {
+	public:
+		using IDVector = std::vector<EntityID>;
+		using ComponentVector = std::vector<Component>;
+		using Lookup = SparseIndex<EntityID, Component>;
+
+	private:
+		IndexMap _indices;
+		IDVector _ids;
+		ComponentVector _components;
+		Lookup _lookup;
+
+	public:
+		std::unique_ptr<ISparseSet<EntityID>> copy() const override {
+			return std::make_unique<SparseSet>(*this);
+		}
+
+		void clone(EntityID source, EntityID dest) override {
+			auto result{ _indices.find(source) };
+			if (result != _indices.end()) {
+				Component component{ _components[result->second] };
+				emplace(dest, std::move(component));
+			}
+		}
+
+		std::unique_ptr<ISparseSet<EntityID>> snapshot(EntityID id) const override {
+			std::unique_ptr<SparseSet> out{ std::make_unique<SparseSet>() };
+			if (const Component* component{ find(id) }) {
+				out->emplace(id, *component);
+			}
+			return out;
+		}
+
+		std::unique_ptr<ISparseSet<EntityID>> create() const override {
+			return std::make_unique<SparseSet>();
+		}
+
+		void fill(const ISparseSet<EntityID>& from, EntityID source, const EntityID* ids, size_t count) override {
+			const Component* component{ static_cast<const SparseSet&>(from).find(source) };
+			if (!component) {
+				return;
+			}
+
+			_ids.reserve(_ids.size() + count);
+			_components.reserve(_components.size() + count);
+			for (size_t _index{}; _index < count; ++_index) {
+				emplace(ids[_index], *component);
+			}
+		}
+
+		template<typename _Component>
+		Component& emplace(EntityID id, _Component&& component) {
+			auto result{ _indices.find(id) };
+			if (result != _indices.end()) {
+				Component& out{ _components[result->second] };
+				_lookup.erase(id, out);
+				out = std::forward<_Component>(component);
+				_lookup.insert(id, out);
+				return out;
+			}
+
+			_indices.emplace(id, _ids.size());
+			_ids.push_back(id);
+			_components.push_back(std::forward<_Component>(component));
+			_lookup.insert(id, _components.back());
+			return _components.back();
+		}
+
+		void reindex(EntityID id) {
+			auto result{ _indices.find(id) };
+			if (result != _indices.end()) {
+				_lookup.erase(id, _components[result->second]);
+				_lookup.insert(id, _components[result->second]);
+			}
+		}
+
+		void erase(EntityID id) override {
+			auto result{ _indices.find(id) };
+			if (result == _indices.end()) {
+				return;
+			}
+
+			size_t _index{ result->second };
+			_lookup.erase(id, _components[_index]);
+
+			if (_index != _ids.size() - 1) {
+				_ids[_index] = _ids.back();
+				_components[_index] = std::move(_components.back());
+				_indices.at(_ids[_index]) = _index;
+			}
+
+			_ids.pop_back();
+			_components.pop_back();
+			_indices.erase(id);
+		}
+
+		Component* find(EntityID id) {
+			auto result{ _indices.find(id) };
+			return result != _indices.end() ? &_components[result->second] : nullptr;
+		}
+
+		const Component* find(EntityID id) const {
+			auto result{ _indices.find(id) };
+			return result != _indices.end() ? &_components[result->second] : nullptr;
+		}
+
+		Component& get(EntityID id) {
+			return _components[_indices.at(id)];
+		}
+
+		const Component& get(EntityID id) const {
+			return _components[_indices.at(id)];
+		}
+
+		bool contains(EntityID id) const override {
+			return _indices.find(id) != _indices.end();
+		}
+
+		size_t size() const override {
+			return _ids.size();
+		}
+
+		size_t bytes() const override {
+			return _ids.capacity() * sizeof(EntityID) + _components.capacity() * sizeof(Component);
+		}
+
+		void trim() override {
+			if (_ids.size() < _ids.capacity() / 2) {
+				_ids.shrink_to_fit();
+				_components.shrink_to_fit();
+			}
+		}
+
+		void clear() override {
+			_indices.clear();
+			_ids.clear();
+			_components.clear();
+			_lookup.clear();
+		}
+
+		const IDVector& ids() const {
+			return _ids;
+		}
+
+		Component* data() {
+			return _components.data();
+		}
+
+		const Lookup& lookup() const {
+			return _lookup;
+		}
+	};
+
+}
\ No newline at end of file
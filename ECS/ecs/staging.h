@@ -0,0 +1,210 @@
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <mutex>
+#include <memory>
+#include <utility>
+#include <typeindex>
+#include <type_traits>
+#include <unordered_map>
+
+#include "component.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	class Staging {
+	public:
+		using World = WorldType;
+		using Archetype = typename World::Archetype;
+		using EntityID = typename World::EntityID;
+		using EntityData = typename World::EntityData;
+
+	private:
+		class IBatch {
+		public:
+			virtual ~IBatch() = default;
+
+			virtual void merge(World& world) = 0;
+
+			virtual size_t size() const = 0;
+
+			virtual void release(World& world) = 0;
+
+			virtual void clear() = 0;
+		};
+
+		template<typename... Components>
+		class Batch : public IBatch {
+		private:
+			std::vector<EntityID> _ids;
+			std::tuple<std::vector<Components>...> _columns;
+
+		public:
+			template<typename... _Components>
+			void push(EntityID id, _Components&&... components) {
+				_ids.push_back(id);
+				(std::get<std::vector<Components>>(_columns).push_back(std::forward<_Components>(components)), ...);
+			}
+
+			void merge(World& world) override {
+				if (_ids.empty()) {
+					return;
+				}
+
+				world._counters.creates += _ids.size();
+				world._counters.attaches += _ids.size() * sizeof...(Components);
+
+				if constexpr (sizeof...(Components) == 0) {
+					for (EntityID id : _ids) {
+						world._entities.emplace(id, EntityData{});
+					}
+				}
+				else {
+					Archetype* arche{ world.template attachArche<Components...>(nullptr) };
+					size_t first{ arche->pushEntities(_ids.data(), _ids.size()) };
+					(place<Components>(*arche, first), ...);
+					arche->touchRows(first, _ids.size(), world._tick);
+					world.observeMove(nullptr, arche, _ids.data(), _ids.size());
+
+					for (size_t _index{}; _index < _ids.size(); ++_index) {
+						world._entities.emplace(_ids[_index], EntityData{ first + _index, arche });
+					}
+				}
+			}
+
+			size_t size() const override {
+				return _ids.size();
+			}
+
+			void release(World& world) override {
+				for (EntityID id : _ids) {
+					world.releaseEntity(id);
+				}
+			}
+
+			void clear() override {
+				_ids.clear();
+				(std::get<std::vector<Components>>(_columns).clear(), ...);
+			}
+
+		private:
+			template<typename Component>
+			void place(Archetype& arche, size_t first) {
+				std::vector<Component>& column{ std::get<std::vector<Component>>(_columns) };
+				for (size_t _index{}; _index < column.size(); ++_index) {
+					arche.template placeComponent<Component>(first + _index, std::move(column[_index]));
+				}
+			}
+		};
+
+		using UBatch = std::unique_ptr<IBatch>;
+		using BatchMap = std::unordered_map<std::type_index, UBatch>;
+
+	public:
+		class Lane {
+		private:
+			World* _world;
+			BatchMap _batches;
+
+		public:
+			Lane(World& world)
+				: _world{ &world } {
+			}
+
+			template<typename... Components>
+			EntityID create(Components&&... components) {
+				static_assert(!(SPARSE_COMPONENT<std::decay_t<Components>> || ...),
+					"Sparse components are attached after merging");
+
+				using Type = Batch<std::decay_t<Components>...>;
+
+				auto result{ _batches.find(typeid(Type)) };
+				if (result == _batches.end()) {
+					result = _batches.emplace(typeid(Type), std::make_unique<Type>()).first;
+				}
+
+				EntityID id{ _world->reserveEntityConcurrent() };
+				static_cast<Type*>(result->second.get())->push(id, std::forward<Components>(components)...);
+				return id;
+			}
+
+			size_t size() const {
+				size_t out{};
+				for (auto& pair : _batches) {
+					out += pair.second->size();
+				}
+				return out;
+			}
+
+		private:
+			friend class Staging;
+
+			void merge() {
+				for (auto& pair : _batches) {
+					pair.second->merge(*_world);
+					pair.second->clear();
+				}
+			}
+
+			void release() {
+				for (auto& pair : _batches) {
+					pair.second->release(*_world);
+					pair.second->clear();
+				}
+			}
+		};
+
+	private:
+		using ULane = std::unique_ptr<Lane>;
+
+		World* _world;
+		std::vector<ULane> _lanes;
+		std::mutex _mutex;
+
+	public:
+		Staging(World& world)
+			: _world{ &world } {
+		}
+
+		Staging(const Staging& left) = delete;
+
+		Staging(Staging&& right) = delete;
+
+		Staging& operator=(const Staging& left) = delete;
+
+		Staging& operator=(Staging&& right) = delete;
+
+		~Staging() {
+			for (ULane& lane : _lanes) {
+				lane->release();
+			}
+		}
+
+		Lane& lane() {
+			std::lock_guard<std::mutex> lock{ _mutex };
+			_lanes.push_back(std::make_unique<Lane>(*_world));
+			return *_lanes.back();
+		}
+
+		size_t size() {
+			std::lock_guard<std::mutex> lock{ _mutex };
+
+			size_t out{};
+			for (const ULane& lane : _lanes) {
+				out += lane->size();
+			}
+			return out;
+		}
+
+		void merge() {
+			std::lock_guard<std::mutex> lock{ _mutex };
+			for (ULane& lane : _lanes) {
+				lane->merge();
+			}
+		}
+
+	};
+
+}
\ No newline at end of file
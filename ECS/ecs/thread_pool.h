@@ -0,0 +1,194 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+
+namespace Byte {
+
+	class ThreadPool {
+	public:
+		using Function = std::function<void()>;
+
+		class TaskGroup {
+		private:
+			friend class ThreadPool;
+
+			std::atomic<size_t> _pending{ 0 };
+
+		public:
+			bool done() const {
+				return _pending.load(std::memory_order_acquire) == 0;
+			}
+		};
+
+	private:
+		struct Task {
+			Function function;
+			TaskGroup* group{ nullptr };
+		};
+
+		struct Queue {
+			std::deque<Task> tasks;
+			std::mutex mutex;
+		};
+
+		using UQueue = std::unique_ptr<Queue>;
+
+		inline static thread_local ThreadPool* _currentPool{ nullptr };
+		inline static thread_local size_t _currentQueue{ 0 };
+
+		std::vector<UQueue> _queues;
+		std::vector<std::thread> _threads;
+
+		std::mutex _sleepMutex;
+		std::condition_variable _wake;
+		std::atomic<size_t> _queued{ 0 };
+		bool _running{ true };
+
+	public:
+		ThreadPool(size_t threadCount = defaultThreadCount()) {
+			for (size_t _index{}; _index <= threadCount; ++_index) {
+				_queues.push_back(std::make_unique<Queue>());
+			}
+
+			for (size_t _index{}; _index < threadCount; ++_index) {
+				_threads.emplace_back([this, _index]() {
+					work(_index + 1);
+				});
+			}
+		}
+
+		ThreadPool(const ThreadPool& left) = delete;
+
+		ThreadPool(ThreadPool&& right) = delete;
+
+		ThreadPool& operator=(const ThreadPool& left) = delete;
+
+		ThreadPool& operator=(ThreadPool&& right) = delete;
+
+		~ThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock{ _sleepMutex };
+				_running = false;
+			}
+			_wake.notify_all();
+
+			for (std::thread& thread : _threads) {
+				thread.join();
+			}
+		}
+
+		size_t threadCount() const {
+			return _threads.size();
+		}
+
+		void submit(TaskGroup& group, Function&& function) {
+			group._pending.fetch_add(1, std::memory_order_relaxed);
+
+			Queue& queue{ *_queues[_currentPool == this ? _currentQueue : 0] };
+			{
+				std::lock_guard<std::mutex> lock{ queue.mutex };
+				queue.tasks.push_back(Task{ std::move(function), &group });
+			}
+
+			{
+				std::lock_guard<std::mutex> lock{ _sleepMutex };
+				_queued.fetch_add(1, std::memory_order_relaxed);
+			}
+			_wake.notify_one();
+		}
+
+		void wait(TaskGroup& group) {
+			while (!group.done()) {
+				if (!runOne(_currentPool == this ? _currentQueue : 0)) {
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		template<typename Function>
+		void parallel(size_t count, Function&& function) {
+			TaskGroup group;
+			for (size_t _index{}; _index < count; ++_index) {
+				submit(group, [&function, _index]() {
+					function(_index);
+				});
+			}
+			wait(group);
+		}
+
+		static size_t defaultThreadCount() {
+			size_t hardware{ std::thread::hardware_concurrency() };
+			return hardware > 1 ? hardware - 1 : 0;
+		}
+
+	private:
+		void work(size_t queueIndex) {
+			_currentPool = this;
+			_currentQueue = queueIndex;
+
+			while (true) {
+				if (runOne(queueIndex)) {
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock{ _sleepMutex };
+				_wake.wait(lock, [this]() {
+					return _queued.load(std::memory_order_relaxed) > 0 || !_running;
+				});
+
+				if (!_running && _queued.load(std::memory_order_relaxed) == 0) {
+					return;
+				}
+			}
+		}
+
+		bool runOne(size_t queueIndex) {
+			Task task;
+			if (!pop(queueIndex, task) && !steal(queueIndex, task)) {
+				return false;
+			}
+
+			_queued.fetch_sub(1, std::memory_order_relaxed);
+			task.function();
+			task.group->_pending.fetch_sub(1, std::memory_order_acq_rel);
+
+			return true;
+		}
+
+		bool pop(size_t queueIndex, Task& task) {
+			Queue& queue{ *_queues[queueIndex] };
+			std::lock_guard<std::mutex> lock{ queue.mutex };
+
+			if (queue.tasks.empty()) {
+				return false;
+			}
+
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+			return true;
+		}
+
+		bool steal(size_t queueIndex, Task& task) {
+			for (size_t offset{ 1 }; offset < _queues.size(); ++offset) {
+				Queue& queue{ *_queues[(queueIndex + offset) % _queues.size()] };
+				std::lock_guard<std::mutex> lock{ queue.mutex };
+
+				if (!queue.tasks.empty()) {
+					task = std::move(queue.tasks.front());
+					queue.tasks.pop_front();
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+}
\ No newline at end of file
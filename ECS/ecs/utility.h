@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 #include <type_traits>
 
 #include "world.h"
@@ -13,59 +14,38 @@ namespace Byte {
 		using Archetype = typename WorldType::Archetype;
 		using Signature = typename WorldType::Signature;
 		using EntityID = typename WorldType::EntityID;
+		using EntityData = typename WorldType::EntityData;
 		using IDContainer = std::vector<EntityID>;
 
 		template<typename Component, typename... Components>
 		static IDContainer spawn(
-			World& world, 
-			size_t count, 
-			Component&& component, 
-			Components&&... components) {
-			Signature signature{ Signature::template build<Component, Components...>() };
-
-			Archetype* dest;
-
-			auto result{ world._arches.find(signature) };
-			if (result != world._arches.end()) {
-				dest = &result->second;
-			}
-			else {
-				world._arches[signature] = Archetype::template build<Component, Components...>();
-				dest = &world._arches[signature];
-			}
-
-			dest->reserve(dest->size() + count);
-
-			IDContainer out;
-			out.reserve(dest->size() + count);
-			world._entities.reserve(count);
-			for (size_t idx{}; idx < count; ++idx) {
-				EntityID id{ world.createEntity() };
-				typename World::EntityData& data{ world._entities.at(id) };
-
-				data.arche = dest;
-				data._index = push(id, dest, component, components...);
-
-				out.push_back(id);
+			World& world,
+			size_t count,
+			const Component& component,
+			const Components&... components) {
+			static_assert(!SPARSE_COMPONENT<Component> && !(SPARSE_COMPONENT<Components> || ...),
+				"Sparse components are attached after spawning");
+
+			IDContainer out(count);
+			world._entities.reserve(world._entities.size() + count);
+			World::EntityIDGenerator::generate(world._entities, out.data(), count);
+
+			Archetype* dest{ world.template attachArche<Component, Components...>(nullptr) };
+			size_t first{ dest->pushEntities(out.data(), count) };
+
+			dest->template fillComponents<Component>(first, component, count);
+			(dest->template fillComponents<Components>(first, components, count), ...);
+			dest->touchRows(first, count, world._tick);
+			world.observeMove(nullptr, dest, out.data(), count);
+			world._counters.creates += count;
+			world._counters.attaches += count * (1 + sizeof...(Components));
+
+			for (size_t _index{}; _index < count; ++_index) {
+				world._entities.emplace(out[_index], EntityData{ first + _index, dest });
 			}
 
 			return out;
 		}
-
-	private:
-		template<typename Component, typename... Components>
-		static size_t push(
-			EntityID id, 
-			Archetype* dest, 
-			Component component, 
-			Components... components) {
-			size_t _index{ dest->pushEntity(id) };
-
-			dest->pushComponent<Component>(std::forward<Component>(component));
-			(dest->pushComponent<Components>(std::forward<Components>(components)), ...);
-
-			return _index;
-		}
 	};
 
 }
\ No newline at end of file
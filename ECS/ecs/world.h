@@ -3,11 +3,23 @@
 #include <unordered_map>
 #include <type_traits>
 #include <vector>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <limits>
+#include <map>
+#include <string>
 
 #include "archetype.h"
+#include "chunked_archetype.h"
 #include "component.h"
 #include "signature.h"
 #include "hash_map.h"
+#include "thread_pool.h"
+#include "sparse_set.h"
+#include "relation.h"
+#include "observer.h"
 
 namespace Byte {
 
@@ -15,7 +27,8 @@ namespace Byte {
 	typename _EntityID,
 	template<typename> class _EntityIDGenerator,
 	template<typename> class _Container,
-	size_t _MAX_COMPONENT_COUNT>
+	size_t _MAX_COMPONENT_COUNT,
+	typename _ComponentList = ComponentList<>>
 	class _World {
 	public:
 		inline static constexpr size_t MAX_COMPONENT_COUNT{ _MAX_COMPONENT_COUNT };
@@ -24,8 +37,9 @@ namespace Byte {
 		using EntityIDGenerator = _EntityIDGenerator<EntityID>;
 		template<typename Component>
 		using Container = _Container<Component>;
-		using Archetype = Archetype<EntityID, Container, MAX_COMPONENT_COUNT>;
-		using Signature = Signature<MAX_COMPONENT_COUNT>;
+		using ComponentList = _ComponentList;
+		using Archetype = Byte::Archetype<EntityID, _Container, MAX_COMPONENT_COUNT, ComponentList>;
+		using Signature = Byte::Signature<MAX_COMPONENT_COUNT, ComponentList>;
 		using ArcheMap = std::unordered_map<Signature, Archetype>;
 
 		struct EntityData {
@@ -33,17 +47,199 @@ namespace Byte {
 			Archetype* arche{ nullptr };
 		};
 
-		using EntityMap = hash_map<EntityID, EntityData>;
+		using EntityMap = typename EntityIDGenerator::template Map<EntityData>;
+
+		struct ArchetypeMemory {
+			Signature signature;
+			size_t size{};
+			size_t capacity{};
+			size_t bytes{};
+			ColumnMemoryVector columns;
+		};
+
+		struct MemoryReport {
+			std::vector<ArchetypeMemory> archetypes;
+			ColumnMemoryVector sparse;
+			size_t bytes{};
+		};
+
+		struct Counters {
+			uint64_t creates{};
+			uint64_t destroys{};
+			uint64_t attaches{};
+			uint64_t detaches{};
+			uint64_t moves{};
+
+			Counters operator-(const Counters& right) const {
+				return Counters{
+					creates - right.creates,
+					destroys - right.destroys,
+					attaches - right.attaches,
+					detaches - right.detaches,
+					moves - right.moves };
+			}
+		};
+
+		using ProbeHistogram = typename EntityMap::probe_histogram;
+
+		struct Stats {
+			size_t entities{};
+			size_t archetypes{};
+			size_t emptyArchetypes{};
+			size_t queries{};
+			size_t bytes{};
+			float loadFactor{};
+			ProbeHistogram probes{};
+			ColumnMemoryVector components;
+			Counters total;
+			Counters frame;
+			MemoryReport memory;
+
+			std::string json() const {
+				std::string out{ "{" };
+				out += "\"entities\":" + std::to_string(entities);
+				out += ",\"archetypes\":" + std::to_string(archetypes);
+				out += ",\"emptyArchetypes\":" + std::to_string(emptyArchetypes);
+				out += ",\"queries\":" + std::to_string(queries);
+				out += ",\"bytes\":" + std::to_string(bytes);
+				out += ",\"loadFactor\":" + std::to_string(loadFactor);
+
+				out += ",\"probes\":[";
+				for (size_t _index{}; _index < probes.size(); ++_index) {
+					out += (_index ? "," : "") + std::to_string(probes[_index]);
+				}
+				out += "]";
+
+				out += ",\"components\":" + json(components);
+				out += ",\"total\":" + json(total);
+				out += ",\"frame\":" + json(frame);
+
+				out += ",\"archetypeMemory\":[";
+				for (size_t _index{}; _index < memory.archetypes.size(); ++_index) {
+					const ArchetypeMemory& arche{ memory.archetypes[_index] };
+					out += _index ? ",{" : "{";
+					out += "\"size\":" + std::to_string(arche.size);
+					out += ",\"capacity\":" + std::to_string(arche.capacity);
+					out += ",\"bytes\":" + std::to_string(arche.bytes);
+					out += ",\"columns\":" + json(arche.columns) + "}";
+				}
+				out += "],\"sparseMemory\":" + json(memory.sparse);
+
+				return out + "}";
+			}
+
+		private:
+			static std::string json(const Counters& counters) {
+				return "{\"creates\":" + std::to_string(counters.creates)
+					+ ",\"destroys\":" + std::to_string(counters.destroys)
+					+ ",\"attaches\":" + std::to_string(counters.attaches)
+					+ ",\"detaches\":" + std::to_string(counters.detaches)
+					+ ",\"moves\":" + std::to_string(counters.moves) + "}";
+			}
+
+			static std::string json(const ColumnMemoryVector& columns) {
+				std::string out{ "[" };
+				for (size_t _index{}; _index < columns.size(); ++_index) {
+					out += _index ? ",{" : "{";
+					out += "\"component\":" + std::to_string(columns[_index].component);
+					out += ",\"bytes\":" + std::to_string(columns[_index].bytes) + "}";
+				}
+				return out + "]";
+			}
+		};
+
+		template<typename Component>
+		using SparseSet = Byte::SparseSet<EntityID, typename EntityIDGenerator::template Map<size_t>, Component>;
+		using USparseSet = std::unique_ptr<ISparseSet<EntityID>>;
+		using SparseMap = std::unordered_map<ComponentID, USparseSet>;
+
+		class Query {
+		public:
+			using ArcheVector = std::vector<Archetype*>;
+
+		private:
+			Signature _signature;
+			ArcheVector _arches;
+
+		public:
+			Query(const Signature& signature)
+				: _signature{ signature } {
+			}
+
+			const Signature& signature() const {
+				return _signature;
+			}
+
+			const ArcheVector& arches() const {
+				return _arches;
+			}
+
+			size_t size() const {
+				size_t out{};
+				for (Archetype* arche : _arches) {
+					out += arche->size();
+				}
+				return out;
+			}
+
+			bool empty() const {
+				for (Archetype* arche : _arches) {
+					if (!arche->empty()) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+		private:
+			friend class _World;
+
+			void notify(Archetype* arche) {
+				if (arche->signature().includes(_signature)) {
+					_arches.push_back(arche);
+				}
+			}
+
+			void forget(Archetype* arche) {
+				std::erase(_arches, arche);
+			}
+		};
+
+		using UQuery = std::unique_ptr<Query>;
+		using QueryMap = std::unordered_map<Signature, UQuery>;
+		using Observer = Byte::Observer<_World>;
+		using ObserverMap = std::unordered_map<ComponentID, Observer>;
 
 	private:
 		template<typename WorldType>
 		friend struct Spawner;
 
+		template<typename WorldType>
+		friend class CommandBuffer;
+
+		template<typename WorldType>
+		friend class Staging;
+
+		template<typename WorldType>
+		friend class Serializer;
+
+		template<typename WorldType>
+		friend class Prefab;
+
 		ArcheMap _arches;
 		EntityMap _entities;
+		QueryMap _queries;
+		SparseMap _sparse;
+		ObserverMap _observers;
+		std::unique_ptr<std::mutex> _queryMutex{ std::make_unique<std::mutex>() };
+		uint64_t _tick{ 1 };
+		Counters _counters;
+		Counters _frameStart;
 
 	public:
-		_World() = default;
+		_World() {
+			prepareList(static_cast<ComponentList*>(nullptr));
+		}
 
 		_World(const _World& left)
 			: _World{ left.copy() } {
@@ -59,11 +255,26 @@ namespace Byte {
 		_World& operator=(_World&& right) noexcept = default;
 
 		EntityID create() {
-			EntityID id{ EntityIDGenerator::generate() };
+			EntityID id{ reserveEntity() };
 			_entities.emplace(id,EntityData{});
+			++_counters.creates;
 			return id;
 		}
 
+		EntityID reserveEntity() {
+			return EntityIDGenerator::generate(_entities);
+		}
+
+		EntityID reserveEntityConcurrent() {
+			return EntityIDGenerator::reserve(_entities);
+		}
+
+		void releaseEntity(EntityID id) {
+			if (!contains(id)) {
+				EntityIDGenerator::release(_entities, id);
+			}
+		}
+
 		template<typename Component, typename... Components>
 		EntityID create(Component&& component, Components&&... components) {
 			EntityID out{ create() };
@@ -76,240 +287,690 @@ namespace Byte {
 
 		void destroy(EntityID id) {
 			EntityData& data{ _entities.at(id) };
-			data.arche->erase(data._index);
+			observeDestroy(id, data.arche);
+			if (data.arche) {
+				EntityID changedEntity{ data.arche->erase(data._index) };
+				_entities.at(changedEntity)._index = data._index;
+				touchHole(data.arche, data._index);
+			}
+			eraseSparse(id);
 			_entities.erase(id);
+			++_counters.destroys;
 		}
 
 		EntityID clone(EntityID source) {
 			EntityID out{ create() };
 			EntityData& sourceData{ _entities.at(source) };
-			sourceData.arche->copyEntity(sourceData._index, out, *sourceData.arche);
-			_entities.at(out).arche = sourceData.arche;
+			size_t _index{ sourceData.arche->copyEntity(sourceData._index, out, *sourceData.arche) };
+			sourceData.arche->touchRows(_index, 1, _tick);
+
+			EntityData& outData{ _entities.at(out) };
+			outData.arche = sourceData.arche;
+			outData._index = _index;
+			observeMove(nullptr, outData.arche, &out, 1);
+
+			for (auto& pair : _sparse) {
+				pair.second->clone(source, out);
+				if (pair.second->contains(out)) {
+					observe(ObserverEvent::ADD, pair.first, &out, 1);
+				}
+			}
 			return out;
 		}
 
 		template<typename Component, typename... Components>
 		void attach(EntityID id, Component&& component, Components&&... components) {
-			Signature signature{ Signature::template build<EntityID,Component,Components...>() };
+			if constexpr (SPARSE_COMPONENT<std::decay_t<Component>> || (SPARSE_COMPONENT<std::decay_t<Components>> || ...)) {
+				attachSparse(id, std::forward<Component>(component));
+				(attachSparse(id, std::forward<Components>(components)), ...);
+			}
+			else {
+				attachDense(id, std::forward<Component>(component), std::forward<Components>(components)...);
+			}
+		}
 
-			EntityData& data{ _entities.at(id) };
+		template<typename Component>
+		void detach(EntityID id) {
+			if (!has<Component>(id)) {
+				return;
+			}
 
-			Archetype* oldArche{ data.arche };
-			Archetype* newArche{ nullptr };
+			if constexpr (SPARSE_COMPONENT<Component>) {
+				eraseSparse(componentID<Component>(), id);
+			}
+			else {
+				detachDense<Component>(id);
+			}
+			++_counters.detaches;
+		}
 
-			if (oldArche) {
-				signature += oldArche->signature();
+		template<typename Component>
+		Component& get(EntityID id) {
+			if constexpr (SPARSE_COMPONENT<Component>) {
+				return sparse<Component>().get(id);
+			}
+			else {
+				EntityData& data{ _entities.at(id) };
+				data.arche->touch(componentID<Component>(), data._index / data.arche->chunkCapacity(), _tick);
+				return data.arche->template getComponent<Component>(data._index);
 			}
+		}
 
-			auto result{ _arches.find(signature) };
-			if (result != _arches.end()){
-				newArche = &result->second;
+		template<typename Component>
+		const Component& get(EntityID id) const {
+			if constexpr (SPARSE_COMPONENT<Component>) {
+				return static_cast<const SparseSet<Component>&>(*_sparse.at(componentID<Component>())).get(id);
 			}
 			else {
-				if (oldArche) {
-					_arches.emplace(signature,Archetype::template build<Component, Components...>(*oldArche));
-				}
-				else {
-					_arches.emplace(signature,Archetype::template build<Component, Components...>());
-				}
-				newArche = &_arches[signature];
+				const EntityData& data{ _entities.at(id) };
+				const Archetype& arche{ *data.arche };
+				return arche.template getComponent<Component>(data._index);
 			}
+		}
 
-			size_t newIndex;
-			if (oldArche) {
-				newIndex = newArche->carryEntity(data._index, id, *oldArche);
+		bool contains(EntityID id) const {
+			return _entities.find(id) != _entities.end();
+		}
 
-				EntityID changedEntity{ oldArche->erase(data._index) };
-				_entities[changedEntity]._index = _entities[id]._index;
+		template<typename Component>
+		bool has(EntityID id) {
+			if constexpr (SPARSE_COMPONENT<Component>) {
+				return sparse<Component>().contains(id);
 			}
 			else {
-				newIndex = newArche->pushEntity(id);
-			}
+				Archetype* arche{ _entities.at(id).arche };
 
-			newArche->pushComponent(std::forward<Component>(component));
-			(newArche->pushComponent(std::forward<Components>(components)), ...);
+				if (arche) {
+					return arche->signature().test(componentID<Component>());
+				}
 
-			data.arche = newArche;
-			data._index = newIndex;
+				return false;
+			}
 		}
 
 		template<typename Component>
-		void detach(EntityID id) {
-			EntityData& data{ _entities.at(id) };
+		SparseSet<std::decay_t<Component>>& sparse() {
+			using Type = std::decay_t<Component>;
 
-			Archetype* oldArche{ data.arche };
+			auto result{ _sparse.find(componentID<Type>()) };
+			if (result != _sparse.end()) {
+				return static_cast<SparseSet<Type>&>(*result->second);
+			}
 
-			Signature signature{ oldArche->signature() };
-			signature.set(Registry<Component>::id(), false);
+			USparseSet& out{ _sparse[componentID<Type>()] };
+			out = std::make_unique<SparseSet<Type>>();
+			return static_cast<SparseSet<Type>&>(*out);
+		}
 
-			size_t newIndex{ 0 };
-			Archetype* newArche{ nullptr };
+		template<typename... Components>
+		void prepare() {
+			(prepareSparse<Components>(), ...);
 
-			if (signature.any()) {
-				auto result{ _arches.find(signature) };
+			Signature writes;
+			((std::is_const_v<Components> || SPARSE_COMPONENT<Components> ? void() : writes.set(componentID<Components>())), ...);
+			if (!writes.any()) {
+				return;
+			}
 
-				if (result == _arches.end()) {
-					_arches.emplace(signature, Archetype::build(*oldArche, Registry<Component>::id()));
-					newArche = &_arches[signature];
+			for (auto& pair : _arches) {
+				if (pair.second.signature().matches(writes)) {
+					pair.second.detachChunks();
 				}
-				else {
-					newArche = &result->second;
-				}
-				newIndex = newArche->carryEntity(data._index, id, *oldArche);
 			}
-			EntityID changedEntity{ oldArche->erase(data._index) };
-			_entities[changedEntity]._index = data._index;
+		}
 
-			data._index = newIndex;
-			data.arche = newArche;
+		template<typename Kind, typename Target>
+		const std::vector<EntityID>& related(const Target& target) {
+			return sparse<Relation<Kind, Target>>().lookup().sources(target);
 		}
 
-		template<typename Component>
-		Component& get(EntityID id) {
-			EntityData& data{ _entities.at(id) };
-			return data.arche->getComponent<Component>(data._index);
+		size_t size() const {
+			return _entities.size();
 		}
 
 		template<typename Component>
-		const Component& get(EntityID id) const {
-			EntityData& data{ _entities.at(id) };
-			return data.arche->getComponent<Component>(data._index);
+		static ComponentID componentID() {
+			return Archetype::template componentID<Component>();
+		}
+
+		uint64_t tick() const {
+			return _tick;
+		}
+
+		template<typename Component, typename Function>
+		void onAdd(Function&& function) {
+			observer<Component>().listen(ObserverEvent::ADD, std::forward<Function>(function));
+		}
+
+		template<typename Component, typename Function>
+		void onRemove(Function&& function) {
+			observer<Component>().listen(ObserverEvent::REMOVE, std::forward<Function>(function));
+		}
+
+		template<typename Component, typename Function>
+		void onChange(Function&& function) {
+			observer<Component>().listen(ObserverEvent::CHANGE, std::forward<Function>(function));
 		}
 
 		template<typename Component>
-		bool has(EntityID id) {
-			Archetype* arche{ _entities.at(id).arche };
+		void modified(EntityID id) {
+			if (!has<Component>(id)) {
+				return;
+			}
 
-			if (arche) {
-				return arche->signature().test(Registry<Component>::id());
+			if constexpr (SPARSE_COMPONENT<Component>) {
+				sparse<Component>().reindex(id);
 			}
+			else {
+				EntityData& data{ _entities.at(id) };
+				data.arche->touch(componentID<Component>(), data._index / data.arche->chunkCapacity(), _tick);
+			}
+			observe(ObserverEvent::CHANGE, componentID<Component>(), &id, 1);
+		}
 
-			return false;
+		void dispatch() {
+			std::vector<Observer*> observers;
+			observers.reserve(_observers.size());
+			for (auto& pair : _observers) {
+				observers.push_back(&pair.second);
+			}
+
+			for (Observer* observer : observers) {
+				observer->dispatch(*this);
+			}
 		}
-		
-		size_t size() const {
-			return _entities.size();
+
+		void compact() {
+			std::vector<Archetype*> dropped;
+			for (auto& pair : _arches) {
+				if (pair.second.empty()) {
+					dropped.push_back(&pair.second);
+				}
+				else {
+					pair.second.trim();
+				}
+			}
+
+			for (auto& pair : _sparse) {
+				pair.second->trim();
+			}
+
+			if (dropped.empty()) {
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock{ *_queryMutex };
+				for (auto& pair : _queries) {
+					for (Archetype* arche : dropped) {
+						pair.second->forget(arche);
+					}
+				}
+			}
+
+			for (auto& pair : _arches) {
+				for (Archetype* arche : dropped) {
+					pair.second.forget(arche);
+				}
+			}
+
+			std::erase_if(_arches, [](const auto& pair) {
+				return pair.second.empty();
+			});
+		}
+
+		MemoryReport memory() const {
+			MemoryReport out;
+			for (auto& pair : _arches) {
+				ArchetypeMemory arche{ pair.first, pair.second.size(), pair.second.capacity(), 0, pair.second.memory() };
+				for (const ColumnMemory& column : arche.columns) {
+					arche.bytes += column.bytes;
+				}
+
+				out.bytes += arche.bytes;
+				out.archetypes.push_back(std::move(arche));
+			}
+
+			for (auto& pair : _sparse) {
+				out.sparse.push_back(ColumnMemory{ pair.first, pair.second->bytes() });
+				out.bytes += pair.second->bytes();
+			}
+
+			return out;
+		}
+
+		uint64_t nextTick() {
+			_frameStart = _counters;
+			return ++_tick;
+		}
+
+		Stats stats() const {
+			Stats out;
+			out.entities = _entities.size();
+			out.archetypes = _arches.size();
+			out.loadFactor = _entities.load_factor();
+			out.probes = _entities.probes();
+			out.total = _counters;
+			out.frame = _counters - _frameStart;
+			out.memory = memory();
+			out.bytes = out.memory.bytes;
+
+			{
+				std::lock_guard<std::mutex> lock{ *_queryMutex };
+				out.queries = _queries.size();
+			}
+
+			std::map<ComponentID, size_t> components;
+			for (const ArchetypeMemory& arche : out.memory.archetypes) {
+				out.emptyArchetypes += arche.size == 0;
+				for (const ColumnMemory& column : arche.columns) {
+					components[column.component] += column.bytes;
+				}
+			}
+
+			for (const ColumnMemory& column : out.memory.sparse) {
+				components[column.component] += column.bytes;
+			}
+
+			for (auto& pair : components) {
+				out.components.push_back(ColumnMemory{ pair.first, pair.second });
+			}
+
+			return out;
 		}
 
+		// Observers stay with the source world. Their callbacks may capture the
+		// owner and their queues hold events the source has yet to dispatch.
 		_World copy() const {
 			_World out;
 			out._arches = _arches;
 			out._entities = _entities;
+			out._tick = _tick;
+			out._counters = _counters;
+			out._frameStart = _frameStart;
+
+			std::unordered_map<const Archetype*, Archetype*> remap;
+			for (auto& pair : _arches) {
+				remap.emplace(&pair.second, &out._arches.at(pair.first));
+			}
+
+			for (auto& pair : out._entities) {
+				if (pair.second.arche) {
+					pair.second.arche = remap.at(pair.second.arche);
+				}
+			}
 
-			for (auto pair: _entities) {
-				auto& test{ out._entities.at(pair.first) };
-				auto& test2{ out._arches.at(pair.second.arche->signature()) };
-				out._entities.at(pair.first).arche = &out._arches.at(pair.second.arche->signature());
+			for (auto& pair : _sparse) {
+				out._sparse[pair.first] = pair.second->copy();
 			}
 
 			return out;
 		}
 
 		template<typename... Components>
-		class ViewIterator {
+		class View {
 		public:
 			using ArcheVector = std::vector<Archetype*>;
-			using Cache = Archetype::template Cache<Components...>;
-			using ComponentGroup = typename Cache::ComponentGroup;
+			using ComponentGroup = std::tuple<Components&...>;
+			using SpanGroup = std::tuple<std::span<Components>...>;
+			using SparseTuple = std::tuple<SparseSet<std::remove_cv_t<Components>>*...>;
+			using FoundTuple = std::tuple<std::remove_cv_t<Components>*...>;
+
+			inline static constexpr ComponentID ANY_COMPONENT{ std::numeric_limits<ComponentID>::max() };
+			inline static constexpr bool SPARSE{ (SPARSE_COMPONENT<Components> || ...) };
+
+			using DenseCache = typename ApplyComponents<Archetype::template Cache, decltype(std::tuple_cat(
+				std::declval<std::tuple<const EntityID>>(),
+				std::declval<DenseComponents<Components...>>()))>::Type;
+			using Cache = std::conditional_t<SPARSE, DenseCache, typename Archetype::template Cache<Components...>>;
+
+			class Iterator {
+			private:
+				const View* _view;
+				size_t _archeIndex;
+				size_t _chunk{};
+				size_t _index{};
+				size_t _end{};
+				Cache _cache;
+				FoundTuple _found{};
+
+			public:
+				Iterator(const View& view, size_t _archeIndex)
+					: _view{ &view }, _archeIndex{ _archeIndex } {
+					seek(true);
+					skip();
+				}
 
-		private:
-			ArcheVector* _arches;
-			size_t _cacheIndex;
-			size_t _index;
-			Cache _cache;
+				Iterator& operator++() {
+					advance();
+					skip();
+					return *this;
+				}
 
-		public:
-			ViewIterator(ArcheVector& _archeVector, size_t _cacheIndex, size_t _index)
-				: _arches{ &_archeVector }, _cacheIndex{ _cacheIndex }, _index{ _index } {
-				if (_cacheIndex < _arches->size()) {
-					_cache = Cache{ *_arches->at(_cacheIndex) };
+				ComponentGroup operator*() {
+					if constexpr (SPARSE) {
+						auto dense{ _cache.group(_index) };
+						return join(dense, std::index_sequence_for<Components...>{});
+					}
+					else {
+						return _cache.group(_index);
+					}
+				}
+
+				bool operator==(const Iterator& left) const {
+					return _archeIndex == left._archeIndex && _chunk == left._chunk;
 				}
-			}
 
-			ViewIterator& operator++() {
-				++_index;
+				bool operator!=(const Iterator& left) const {
+					return !(*this == left);
+				}
 
-				if (_index == _cache.size()) {
-					_index = 0;
-					++_cacheIndex;
-					if (_cacheIndex != _arches->size()) {
-						_cache = Cache{ *_arches->at(_cacheIndex) };
+			private:
+				void seek(bool reload) {
+					const ArcheVector& arches{ _view->arches() };
+
+					while (_archeIndex < arches.size()) {
+						Archetype* arche{ arches[_archeIndex] };
+
+						if (_chunk < arche->chunkCount()) {
+							if (_view->accepts(*arche, _chunk)) {
+								if (reload) {
+									_cache = Cache{ *arche };
+								}
+
+								_index = _chunk * arche->chunkCapacity();
+								_end = _index + arche->chunkSize(_chunk);
+								_view->touch(*arche, _chunk);
+								return;
+							}
+							++_chunk;
+						}
+						else {
+							++_archeIndex;
+							_chunk = 0;
+							reload = true;
+						}
 					}
 				}
 
-				return *this;
-			}
+				void advance() {
+					++_index;
 
-			ComponentGroup operator*() {
-				return _cache.group(_index);
-			}
+					if (_index == _end) {
+						++_chunk;
+						seek(false);
+					}
+				}
 
-			bool operator==(const ViewIterator& left) const {
-				return _cacheIndex == left._cacheIndex;
-			}
+				void skip() {
+					if constexpr (SPARSE) {
+						while (_archeIndex < _view->arches().size()
+							&& !match(std::get<0>(_cache.group(_index)), std::index_sequence_for<Components...>{})) {
+							advance();
+						}
+					}
+				}
 
-			bool operator!=(const ViewIterator& left) const {
-				return !(*this == left);
-			}
+				template<size_t... Indices>
+				bool match(EntityID id, std::index_sequence<Indices...>) {
+					return (find<Indices>(id) && ...);
+				}
 
-		};
+				template<size_t Index>
+				bool find(EntityID id) {
+					if constexpr (SPARSE_COMPONENT<std::tuple_element_t<Index, std::tuple<Components...>>>) {
+						std::get<Index>(_found) = std::get<Index>(_view->_sets)->find(id);
+						return std::get<Index>(_found) != nullptr;
+					}
+					else {
+						return true;
+					}
+				}
 
-		template<typename... Components>
-		class View {
-		public:
-			using ArcheVector = std::vector<Archetype*>;
-			using Iterator = ViewIterator<Components...>;
+				template<typename Group, size_t... Indices>
+				ComponentGroup join(Group& dense, std::index_sequence<Indices...>) {
+					return ComponentGroup(element<Indices>(dense)...);
+				}
+
+				template<size_t Index, typename Group>
+				auto& element(Group& dense) {
+					if constexpr (SPARSE_COMPONENT<std::tuple_element_t<Index, std::tuple<Components...>>>) {
+						return *std::get<Index>(_found);
+					}
+					else {
+						return std::get<denseIndex<Index>()>(dense);
+					}
+				}
+
+			};
+
+			class SpanIterator {
+			private:
+				const View* _view;
+				size_t _archeIndex;
+				size_t _chunk{};
+
+			public:
+				SpanIterator(const View& view, size_t _archeIndex)
+					: _view{ &view }, _archeIndex{ _archeIndex } {
+					seek();
+				}
+
+				SpanIterator& operator++() {
+					++_chunk;
+					seek();
+					return *this;
+				}
+
+				SpanGroup operator*() const {
+					Archetype* arche{ _view->arches()[_archeIndex] };
+					size_t count{ arche->chunkSize(_chunk) };
+					return SpanGroup{ std::span<Components>{ arche->template chunkData<Components>(_chunk), count }... };
+				}
+
+				bool operator==(const SpanIterator& left) const {
+					return _archeIndex == left._archeIndex && _chunk == left._chunk;
+				}
+
+				bool operator!=(const SpanIterator& left) const {
+					return !(*this == left);
+				}
+
+			private:
+				void seek() {
+					const ArcheVector& arches{ _view->arches() };
+
+					while (_archeIndex < arches.size()) {
+						Archetype* arche{ arches[_archeIndex] };
+
+						if (_chunk < arche->chunkCount()) {
+							if (_view->accepts(*arche, _chunk)) {
+								_view->touch(*arche, _chunk);
+								return;
+							}
+							++_chunk;
+						}
+						else {
+							++_archeIndex;
+							_chunk = 0;
+						}
+					}
+				}
+
+			};
+
+			class Spans {
+			private:
+				View _view;
+
+			public:
+				Spans(const View& view)
+					: _view{ view } {
+				}
+
+				SpanIterator begin() const {
+					return SpanIterator{ _view, 0 };
+				}
+
+				SpanIterator end() const {
+					return SpanIterator{ _view, _view.arches().size() };
+				}
+			};
 
 		private:
+			_World* _world;
+			const Query* _query;
 			ArcheVector _archeVector;
+			bool _filtered{ false };
+			bool _changedOnly{ false };
+			ComponentID _changed{ ANY_COMPONENT };
+			uint64_t _since{};
+			SparseTuple _sets{};
 
 		public:
-			View(_World& world) {
-				Signature signature{ Signature::template build<Components...>() };
+			View(_World& world)
+				: View{ world, world.template query<Components...>() } {
+			}
 
-				for (auto& pair : world._arches) {
-					if (pair.second.signature().includes(signature) && !pair.second.empty()) {
-						_archeVector.push_back(&pair.second);
-					}
+			View(_World& world, const Query& query)
+				: _world{ &world }, _query{ &query } {
+				if constexpr (SPARSE) {
+					_sets = SparseTuple{ sparseSet<Components>()... };
 				}
 			}
 
-			Iterator begin() {
-				return Iterator{ _archeVector,0,0 };
+			Iterator begin() const {
+				return Iterator{ *this, 0 };
 			}
 
-			Iterator end() {
-				return Iterator{ _archeVector, _archeVector.size(), 0 };
+			Iterator end() const {
+				return Iterator{ *this, arches().size() };
 			}
 
-			template<typename... _Components>
-			View include() {
-				Signature signature{ Signature::template build<_Components...>() };
-				ArcheVector newArches;
+			const ArcheVector& arches() const {
+				return _filtered ? _archeVector : _query->arches();
+			}
 
-				for (auto arche : _archeVector) {
-					if (!arche->signature().matches(signature) && !arche->empty()) {
-						newArches.push_back(arche);
+			Spans spans() const {
+				static_assert(!SPARSE, "Sparse components have no chunk spans");
+				return Spans{ *this };
+			}
+
+			template<typename Function>
+			void eachChunk(Function&& function) {
+				static_assert(!SPARSE, "Sparse components have no chunk spans");
+				for (Archetype* arche : arches()) {
+					for (size_t chunk{}; chunk < arche->chunkCount(); ++chunk) {
+						if (accepts(*arche, chunk)) {
+							touch(*arche, chunk);
+							function(arche->chunkSize(chunk), arche->template chunkData<Components>(chunk)...);
+						}
 					}
 				}
+			}
 
-				_archeVector = newArches;
+			template<typename Function>
+			void eachChunk(ThreadPool& pool, Function&& function) {
+				static_assert(!SPARSE, "Sparse components have no chunk spans");
+				std::vector<std::tuple<size_t, Components*...>> chunks;
+				for (Archetype* arche : arches()) {
+					for (size_t chunk{}; chunk < arche->chunkCount(); ++chunk) {
+						if (accepts(*arche, chunk)) {
+							touch(*arche, chunk);
+							chunks.emplace_back(arche->chunkSize(chunk), arche->template chunkData<Components>(chunk)...);
+						}
+					}
+				}
 
-				return *this;
+				pool.parallel(chunks.size(), [&function, &chunks](size_t _index) {
+					std::apply(function, chunks[_index]);
+				});
+			}
+
+			template<typename... _Components>
+			View include() {
+				static_assert(!(SPARSE_COMPONENT<_Components> || ...), "Sparse components filter through the view's component list");
+				Signature signature{ Signature::template build<_Components...>() };
+				return filter([&signature](Archetype* arche) {
+					return arche->signature().includes(signature);
+				});
 			}
 
 			template<typename... _Components>
 			View exclude() {
+				static_assert(!(SPARSE_COMPONENT<_Components> || ...), "Sparse components filter through the view's component list");
 				Signature signature{ Signature::template build<_Components...>() };
+				return filter([&signature](Archetype* arche) {
+					return !arche->signature().matches(signature);
+				});
+			}
+
+			View changedSince(uint64_t tick) {
+				_changedOnly = true;
+				_changed = ANY_COMPONENT;
+				_since = tick;
+				return *this;
+			}
+
+			template<typename Component>
+			View changedSince(uint64_t tick) {
+				static_assert(!SPARSE_COMPONENT<Component>, "Sparse components are not change tracked");
+				_changedOnly = true;
+				_changed = componentID<Component>();
+				_since = tick;
+				return *this;
+			}
+
+			bool accepts(Archetype& arche, size_t chunk) const {
+				if (!_changedOnly) {
+					return true;
+				}
+
+				if (_changed != ANY_COMPONENT) {
+					return arche.version(_changed, chunk) > _since;
+				}
+
+				return ((!SPARSE_COMPONENT<Components> && arche.version(componentID<Components>(), chunk) > _since) || ...);
+			}
+
+			void touch(Archetype& arche, size_t chunk) const {
+				((std::is_const_v<Components> || SPARSE_COMPONENT<Components> ? void() : arche.touch(componentID<Components>(), chunk, _world->_tick)), ...);
+			}
+
+		private:
+			template<typename Component>
+			SparseSet<std::remove_cv_t<Component>>* sparseSet() {
+				if constexpr (SPARSE_COMPONENT<Component>) {
+					return &_world->template sparse<Component>();
+				}
+				else {
+					return nullptr;
+				}
+			}
+
+			template<size_t Index>
+			static constexpr size_t denseIndex() {
+				constexpr bool dense[]{ !SPARSE_COMPONENT<Components>... };
+
+				size_t out{ 1 };
+				for (size_t _index{}; _index < Index; ++_index) {
+					out += dense[_index];
+				}
+				return out;
+			}
+
+			template<typename Predicate>
+			View filter(Predicate&& predicate) {
 				ArcheVector newArches;
 
-				for (auto arche : _archeVector) {
-					if (!arche->signature().matches(signature) && !arche->empty()) {
+				for (auto arche : arches()) {
+					if (predicate(arche) && !arche->empty()) {
 						newArches.push_back(arche);
 					}
 				}
 
-				_archeVector = newArches;
+				_archeVector = std::move(newArches);
+				_filtered = true;
 
 				return *this;
 			}
@@ -318,7 +979,281 @@ namespace Byte {
 
 		template<typename... Components>
 		View<Components...> components() {
-			return View<Components...>{ *this };
+			return View<Components...>{ *this, query<Components...>() };
+		}
+
+		template<typename... Components>
+		const Query& query() {
+			Signature signature{ Signature::template build<Components...>() };
+			((SPARSE_COMPONENT<Components> ? signature.set(componentID<Components>(), false) : void()), ...);
+			std::lock_guard<std::mutex> lock{ *_queryMutex };
+
+			UQuery& out{ _queries[signature] };
+			if (!out) {
+				out = std::make_unique<Query>(signature);
+				for (auto& pair : _arches) {
+					out->notify(&pair.second);
+				}
+			}
+
+			return *out;
+		}
+
+	private:
+		template<template<typename...> class List, typename... Components>
+		void prepareList(List<Components...>*) {
+			(prepareSparse<Components>(), ...);
+		}
+
+		template<typename Component>
+		void prepareSparse() {
+			if constexpr (SPARSE_COMPONENT<Component>) {
+				sparse<Component>();
+			}
+		}
+
+		template<typename Component, typename... Components>
+		void attachDense(EntityID id, Component&& component, Components&&... components) {
+			EntityData& data{ _entities.at(id) };
+
+			Archetype* oldArche{ data.arche };
+			Archetype* newArche{ nullptr };
+
+			if constexpr (sizeof...(Components) > 0) {
+				// Present components are assigned in place, so the row never holds two of them.
+				if (oldArche && (oldArche->signature().test(componentID<Component>()) || ... || oldArche->signature().test(componentID<Components>()))) {
+					attachDense(id, std::forward<Component>(component));
+					(attachDense(id, std::forward<Components>(components)), ...);
+					return;
+				}
+			}
+
+			_counters.attaches += 1 + sizeof...(Components);
+
+			if constexpr (sizeof...(Components) == 0) {
+				if (oldArche && oldArche->signature().test(componentID<Component>())) {
+					oldArche->template getComponent<std::decay_t<Component>>(data._index) = std::forward<Component>(component);
+					oldArche->touch(componentID<Component>(), data._index / oldArche->chunkCapacity(), _tick);
+					observe(ObserverEvent::CHANGE, componentID<Component>(), &id, 1);
+					return;
+				}
+
+				newArche = attachEdge<Component>(oldArche);
+			}
+			else {
+				newArche = attachArche<Component, Components...>(oldArche);
+			}
+
+			size_t newIndex;
+			if (oldArche) {
+				newIndex = newArche->carryEntity(data._index, id, *oldArche);
+
+				EntityID changedEntity{ oldArche->erase(data._index) };
+				_entities[changedEntity]._index = _entities[id]._index;
+				touchHole(oldArche, data._index);
+			}
+			else {
+				newIndex = newArche->pushEntity(id);
+			}
+
+			newArche->pushComponent(std::forward<Component>(component));
+			(newArche->pushComponent(std::forward<Components>(components)), ...);
+			newArche->touchRows(newIndex, 1, _tick);
+			++_counters.moves;
+			observeMove(oldArche, newArche, &id, 1);
+
+			data.arche = newArche;
+			data._index = newIndex;
+		}
+
+		template<typename Component>
+		void detachDense(EntityID id) {
+			EntityData& data{ _entities.at(id) };
+
+			Archetype* oldArche{ data.arche };
+
+			size_t newIndex{ 0 };
+			Archetype* newArche{ detachEdge(oldArche, componentID<Component>()) };
+
+			if (newArche) {
+				newIndex = newArche->carryEntity(data._index, id, *oldArche);
+				newArche->touchRows(newIndex, 1, _tick);
+			}
+			EntityID changedEntity{ oldArche->erase(data._index) };
+			_entities[changedEntity]._index = data._index;
+			touchHole(oldArche, data._index);
+			++_counters.moves;
+			observeMove(oldArche, newArche, &id, 1);
+
+			data._index = newIndex;
+			data.arche = newArche;
+		}
+
+		template<typename Component>
+		void attachSparse(EntityID id, Component&& component) {
+			if constexpr (SPARSE_COMPONENT<std::decay_t<Component>>) {
+				EntityData& data{ _entities.at(id) };
+				if (!data.arche) {
+					data.arche = attachArche<>(nullptr);
+					data._index = data.arche->pushEntity(id);
+					data.arche->touchRows(data._index, 1, _tick);
+					++_counters.moves;
+				}
+
+				SparseSet<std::decay_t<Component>>& set{ sparse<Component>() };
+				ObserverEvent event{ set.contains(id) ? ObserverEvent::CHANGE : ObserverEvent::ADD };
+				set.emplace(id, std::forward<Component>(component));
+				observe(event, componentID<Component>(), &id, 1);
+				++_counters.attaches;
+			}
+			else {
+				attachDense(id, std::forward<Component>(component));
+			}
+		}
+
+		void eraseSparse(EntityID id) {
+			for (auto& pair : _sparse) {
+				pair.second->erase(id);
+			}
+		}
+
+		void eraseSparse(ComponentID component, EntityID id) {
+			auto result{ _sparse.find(component) };
+			if (result != _sparse.end() && result->second->contains(id)) {
+				result->second->erase(id);
+				observe(ObserverEvent::REMOVE, component, &id, 1);
+			}
+		}
+
+		template<typename Component>
+		Observer& observer() {
+			return _observers[componentID<Component>()];
+		}
+
+		void observe(ObserverEvent event, ComponentID component, const EntityID* ids, size_t count) {
+			if (_observers.empty()) {
+				return;
+			}
+
+			auto result{ _observers.find(component) };
+			if (result != _observers.end()) {
+				result->second.push(event, ids, count);
+			}
+		}
+
+		void observeMove(const Archetype* source, const Archetype* dest, const EntityID* ids, size_t count) {
+			for (auto& pair : _observers) {
+				bool before{ source && source->signature().test(pair.first) };
+				bool after{ dest && dest->signature().test(pair.first) };
+
+				if (after && !before) {
+					pair.second.push(ObserverEvent::ADD, ids, count);
+				}
+				else if (before && !after) {
+					pair.second.push(ObserverEvent::REMOVE, ids, count);
+				}
+			}
+		}
+
+		void observeDestroy(EntityID id, const Archetype* arche) {
+			for (auto& pair : _observers) {
+				auto set{ _sparse.find(pair.first) };
+				if ((arche && arche->signature().test(pair.first))
+					|| (set != _sparse.end() && set->second->contains(id))) {
+					pair.second.push(ObserverEvent::REMOVE, id);
+				}
+			}
+		}
+
+		template<typename Component>
+		Archetype* attachEdge(Archetype* oldArche) {
+			if (!oldArche) {
+				return attachArche<Component>(oldArche);
+			}
+
+			ComponentID component{ componentID<Component>() };
+			if (oldArche->signature().test(component)) {
+				return oldArche;
+			}
+
+			Archetype*& edge{ oldArche->edge(component).add };
+
+			if (!edge) {
+				edge = attachArche<Component>(oldArche);
+				edge->edge(component).remove = oldArche;
+			}
+
+			return edge;
+		}
+
+		Archetype* detachEdge(Archetype* oldArche, ComponentID component) {
+			if (!oldArche || !oldArche->signature().test(component)) {
+				return oldArche;
+			}
+
+			Archetype*& edge{ oldArche->edge(component).remove };
+
+			if (!edge) {
+				edge = detachArche(oldArche, component);
+				if (edge) {
+					edge->edge(component).add = oldArche;
+				}
+			}
+
+			return edge;
+		}
+
+		template<typename... Components>
+		Archetype* attachArche(Archetype* oldArche) {
+			Signature signature{ Signature::template build<EntityID, Components...>() };
+
+			if (oldArche) {
+				signature += oldArche->signature();
+			}
+
+			auto result{ _arches.find(signature) };
+			if (result != _arches.end()) {
+				return &result->second;
+			}
+
+			if (oldArche) {
+				return emplaceArche(signature, Archetype::template build<Components...>(*oldArche));
+			}
+
+			return emplaceArche(signature, Archetype::template build<Components...>());
+		}
+
+		Archetype* detachArche(Archetype* oldArche, ComponentID without) {
+			Signature signature{ oldArche->signature() };
+			signature.set(without, false);
+
+			if (!signature.any()) {
+				return nullptr;
+			}
+
+			auto result{ _arches.find(signature) };
+			if (result != _arches.end()) {
+				return &result->second;
+			}
+
+			return emplaceArche(signature, Archetype::build(*oldArche, without));
+		}
+
+		void touchHole(Archetype* arche, size_t _index) {
+			if (_index < arche->size()) {
+				arche->touchRows(_index, 1, _tick);
+			}
+		}
+
+		Archetype* emplaceArche(const Signature& signature, Archetype&& arche) {
+			Archetype* out{ &_arches.emplace(signature, std::move(arche)).first->second };
+
+			std::lock_guard<std::mutex> lock{ *_queryMutex };
+			for (auto& pair : _queries) {
+				pair.second->notify(out);
+			}
+
+			return out;
 		}
 
 	};
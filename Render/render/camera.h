@@ -11,6 +11,16 @@ namespace Byte {
         float _nearPlane{ 0.5f };
         float _farPlane{ 500.0f };
 
+        mutable Mat4 _projection;
+        mutable Mat4 _inverseProjection;
+        mutable float _aspectRatio{};
+        mutable bool _inverted{};
+
+        mutable Mat4 _view;
+        mutable Mat4 _inverseView;
+        mutable TransformData _eye;
+        mutable bool _viewed{};
+
     public:
         Camera() = default;
 
@@ -31,14 +41,17 @@ namespace Byte {
         }
 
         float nearPlane(float near) {
+            invalidate();
             return _nearPlane = near;
         }
 
         float farPlane(float far) {
+            invalidate();
             return _farPlane = far;
         }
 
         float fov(float fov) {
+            invalidate();
             return _fov = fov;
         }
 
@@ -46,8 +59,45 @@ namespace Byte {
             return Mat4::perspective(aspectRatio, _fov, near, far);
         }
 
-        Mat4 perspective(float aspectRatio) const {
-            return Mat4::perspective(aspectRatio, _fov, _nearPlane, _farPlane);
+        const Mat4& perspective(float aspectRatio) const {
+            if (aspectRatio != _aspectRatio) {
+                _projection = Mat4::perspective(aspectRatio, _fov, _nearPlane, _farPlane);
+                _aspectRatio = aspectRatio;
+                _inverted = false;
+            }
+            return _projection;
+        }
+
+        const Mat4& inversePerspective(float aspectRatio) const {
+            const Mat4& projection{ perspective(aspectRatio) };
+            if (!_inverted) {
+                _inverseProjection = projection.inverse();
+                _inverted = true;
+            }
+            return _inverseProjection;
+        }
+
+        const Mat4& view(const Transform& transform) const {
+            const TransformData& eye{ transform.global() };
+            if (!_viewed || !sameEye(eye)) {
+                _inverseView = composeTRS(TransformData{ eye.position, Vec3{ 1.0f, 1.0f, 1.0f }, eye.rotation });
+                _view = Mat4::identity();
+                for (size_t row{}; row < 3; ++row) {
+                    Vec3 axis{ _inverseView(0, row), _inverseView(1, row), _inverseView(2, row) };
+                    _view(row, 0) = axis.x;
+                    _view(row, 1) = axis.y;
+                    _view(row, 2) = axis.z;
+                    _view(row, 3) = -axis.dot(eye.position);
+                }
+                _eye = eye;
+                _viewed = true;
+            }
+            return _view;
+        }
+
+        const Mat4& inverseView(const Transform& transform) const {
+            view(transform);
+            return _inverseView;
         }
 
         Mat4 orthographic(float left, float right, float bottom, float top, float near, float far) const {
@@ -57,6 +107,20 @@ namespace Byte {
         Mat4 orthographic(float left, float right, float bottom, float top) const {
             return Mat4::orthographic(left, right, bottom, top, _nearPlane, _farPlane);
         }
+
+    private:
+        void invalidate() {
+            _aspectRatio = 0.0f;
+            _inverted = false;
+        }
+
+        bool sameEye(const TransformData& eye) const {
+            return eye.position == _eye.position
+                && eye.rotation.w == _eye.rotation.w
+                && eye.rotation.x == _eye.rotation.x
+                && eye.rotation.y == _eye.rotation.y
+                && eye.rotation.z == _eye.rotation.z;
+        }
     };
 
 }
\ No newline at end of file
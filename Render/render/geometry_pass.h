@@ -29,8 +29,8 @@ namespace Byte {
 			auto [camera, cameraTransform] = context.camera();
 			float aspect{ static_cast<float>(data.width) / static_cast<float>(data.height) };
 
-			Mat4 projection{ camera.perspective(aspect) };
-			Mat4 view{ cameraTransform.view() };
+			const Mat4& projection{ camera.perspective(aspect) };
+			const Mat4& view{ camera.view(cameraTransform) };
 
 			Framebuffer& geometryBuffer{ data.framebuffers.at(_geometryBuffer) };
 
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <stdexcept>
+
 #include "core/core_types.h"
 #include "core/asset.h"
 #include "core/layout.h"
+#include "core/transform_stream.h"
 #include "ecs/ecs.h"
 #include "render_types.h"
 
@@ -13,6 +16,8 @@ namespace Byte {
 		AssetID _mesh{};
 		AssetID _material{};
 		Vector<RenderID> _keys;
+		mutable Map<RenderID, size_t> _slots;
+		mutable bool _reindex{ false };
 		Vector<float> _data;
 		Layout _layout;
 
@@ -66,10 +71,16 @@ namespace Byte {
 			return _keys;
 		}
 
+		[[deprecated("Edit instances through submit and remove")]]
 		Vector<RenderID>& keys() {
+			_reindex = true;
 			return _keys;
 		}
 
+		bool contains(RenderID key) const {
+			return slots().find(key) != slots().end();
+		}
+
 		const Vector<float>& data() const {
 			return _data;
 		}
@@ -80,66 +91,81 @@ namespace Byte {
 
 		void clear() {
 			_keys.clear();
+			_slots.clear();
+			_reindex = false;
 			_data.clear();
 			_changed = true;
 		}
 
 		void remove(RenderID key) {
-			auto it{ std::find(_keys.begin(), _keys.end(), key) };
-			if (it != _keys.end()) {
-				std::ptrdiff_t index{ std::distance(_keys.begin(), it) };
-				_keys.erase(it);
+			auto it{ slots().find(key) };
+			if (it != _slots.end()) {
+				size_t index{ it->second };
+				size_t last{ _keys.size() - 1 };
 				size_t stride{ _layout.stride() / sizeof(float) };
-				auto start{ _data.begin() + static_cast<size_t>(index) * stride };
-				auto end{ _data.begin() + (static_cast<size_t>(index) + 1) * stride };
-				_data.erase(start, end);
+
+				if (index != last) {
+					_keys[index] = _keys[last];
+					_slots[_keys[index]] = index;
+					std::copy(_data.begin() + last * stride, _data.begin() + (last + 1) * stride, _data.begin() + index * stride);
+				}
+
+				_slots.erase(it);
+				_keys.pop_back();
+				_data.resize(last * stride);
 				_changed = true;
 			}
 		}
 
 		void submit(RenderID id, Vector<float>&& add) {
-			_keys.push_back(id);
-			
+			claim(id);
 			_data.insert(_data.end(), std::make_move_iterator(add.begin()), std::make_move_iterator(add.end()));
 
 			_changed = true;
 		}
 
 		void submit(RenderID id, const Transform& transform) {
-			_keys.push_back(id);
+			claim(id);
+			size_t offset{ _data.size() };
+			_data.resize(offset + TransformStream::INSTANCE_STRIDE);
+			write(_data.data() + offset, transform);
 
-			_data.push_back(transform.position().x);
-			_data.push_back(transform.position().y);
-			_data.push_back(transform.position().z);
+			_changed = true;
+		}
 
-			_data.push_back(transform.scale().x);
-			_data.push_back(transform.scale().y);
-			_data.push_back(transform.scale().z);
+		void submit(const Vector<RenderID>& ids, const TransformStream& stream) {
+			if (_keys != ids) {
+				Map<RenderID, size_t> slots;
+				for (size_t index{ 0 }; index < ids.size(); ++index) {
+					if (!slots.emplace(ids[index], index).second) {
+						throw std::invalid_argument("Instance submitted twice");
+					}
+				}
 
-			_data.push_back(transform.rotation().x);
-			_data.push_back(transform.rotation().y);
-			_data.push_back(transform.rotation().z);
-			_data.push_back(transform.rotation().w);
+				_keys = ids;
+				_slots = std::move(slots);
+				_reindex = false;
+			}
+
+			_data.resize(stream.size() * TransformStream::INSTANCE_STRIDE);
+			stream.pack(_data.data());
 
 			_changed = true;
 		}
 
 		void update(RenderID id, const Transform& transform) {
-			Vector<float> data{
-				transform.position().x, transform.position().y, transform.position().z,
-				transform.scale().x, transform.scale().y, transform.scale().z,
-				transform.rotation().x, transform.rotation().y, transform.rotation().z, transform.rotation().w
-			};
-
-			update(id, std::move(data));
+			auto it{ slots().find(id) };
+			if (it != _slots.end()) {
+				write(_data.data() + it->second * (_layout.stride() / sizeof(float)), transform);
+				_changed = true;
+			}
 		}
 
 		void update(RenderID id, Vector<float>&& add) {
-			auto it{ std::find(_keys.begin(), _keys.end(), id) };
-			if (it != _keys.end()) {
-				std::ptrdiff_t index{ std::distance(_keys.begin(), it) };
+			auto it{ slots().find(id) };
+			if (it != _slots.end()) {
 				size_t stride{ _layout.stride() / sizeof(float) };
-				size_t offset{ static_cast<size_t>(index) * stride };
+				size_t offset{ it->second * stride };
 				for (size_t i{ 0 }; i < add.size(); ++i) {
 					_data[offset + i] = add[i];
 				}
@@ -158,6 +184,39 @@ namespace Byte {
 		size_t count() const {
 			return _keys.size();
 		}
+
+	private:
+		Map<RenderID, size_t>& slots() const {
+			if (_reindex) {
+				_slots.clear();
+				for (size_t index{ 0 }; index < _keys.size(); ++index) {
+					_slots[_keys[index]] = index;
+				}
+				_reindex = false;
+			}
+			return _slots;
+		}
+
+		void claim(RenderID id) {
+			if (!slots().emplace(id, _keys.size()).second) {
+				throw std::invalid_argument("Instance submitted twice");
+			}
+			_keys.push_back(id);
+		}
+
+		static void write(float* out, const Transform& transform) {
+			const TransformData& data{ transform.global() };
+			out[0] = data.position.x;
+			out[1] = data.position.y;
+			out[2] = data.position.z;
+			out[3] = data.scale.x;
+			out[4] = data.scale.y;
+			out[5] = data.scale.z;
+			out[6] = data.rotation.x;
+			out[7] = data.rotation.y;
+			out[8] = data.rotation.z;
+			out[9] = data.rotation.w;
+		}
 	};
 
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/core_types.h"
+#include "ecs/ecs.h"
 
 namespace Byte {
 
@@ -12,6 +13,14 @@ namespace Byte {
 		InstanceRenderer(AssetID instanceGroup)
 			: _instanceGroup{ instanceGroup } {
 		}
+
+		AssetID instanceGroup() const {
+			return _instanceGroup;
+		}
 	};
 
+	struct RenderedBy {};
+
+	using RenderedByGroup = Relation<RenderedBy, AssetID>;
+
 }
\ No newline at end of file
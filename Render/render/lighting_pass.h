@@ -81,10 +81,9 @@ namespace Byte {
 			auto [camera, cameraTransform] = context.camera();
 			float aspect{ static_cast<float>(data.width) / static_cast<float>(data.height) };
 
-			Mat4 view{ cameraTransform.view() };
-			Mat4 inverseView{ view.inverse() };
-			Mat4 projection{ camera.perspective(aspect) };
-			Mat4 inverseProjection{ projection.inverse() };
+			const Mat4& view{ camera.view(cameraTransform) };
+			const Mat4& inverseView{ camera.inverseView(cameraTransform) };
+			const Mat4& inverseProjection{ camera.inversePerspective(aspect) };
 
 			Shader& lightingShader{ data.shaders.at(_lightingShader) };
 
@@ -142,9 +141,9 @@ namespace Byte {
 			data.device.memory().bind(pointLightGroup);
 
 			data.device.shader().set(pointLightShader, "uProjection", camera.perspective(aspect));
-			data.device.shader().set(pointLightShader, "uView", cameraTransform.view());
-			data.device.shader().set(pointLightShader, "uInverseView", cameraTransform.view().inverse());
-			data.device.shader().set(pointLightShader, "uInverseProjection", camera.perspective(aspect).inverse());
+			data.device.shader().set(pointLightShader, "uView", camera.view(cameraTransform));
+			data.device.shader().set(pointLightShader, "uInverseView", camera.inverseView(cameraTransform));
+			data.device.shader().set(pointLightShader, "uInverseProjection", camera.inversePerspective(aspect));
 			data.device.shader().set(pointLightShader, "uViewPos", cameraTransform.position());
 			data.device.shader().set(pointLightShader, "uViewPortSize", viewPortSize);
 
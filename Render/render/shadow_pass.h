@@ -38,7 +38,7 @@ namespace Byte {
 
 			float far{ camera.farPlane() };
 			float near{ camera.nearPlane() };
-			Mat4 cameraView{ cameraTransform.view() };
+			const Mat4& cameraView{ camera.view(cameraTransform) };
 
 			for (size_t idx{}; idx < data.parameter<uint64_t>("cascade_count"); ++idx) {
 				float cascadeDivisor{ data.parameter<float>("cascade_divisor_" + std::to_string(idx)) };
@@ -33,11 +33,11 @@ namespace Byte {
 			auto [camera, cameraTransform] = context.camera();
 
 			float aspect{ static_cast<float>(data.width) / static_cast<float>(data.height) };
-			Mat4 projection{ camera.perspective(aspect) };
-			Transform cTemp{ cameraTransform };
-			cTemp.position(Vec3{});
-			Mat4 view{ cTemp.view() };
-			Mat4 inverseViewProjection{ (projection * view).inverse() };
+			Mat4 inverseView{ camera.inverseView(cameraTransform) };
+			inverseView(0, 3) = 0.0f;
+			inverseView(1, 3) = 0.0f;
+			inverseView(2, 3) = 0.0f;
+			Mat4 inverseViewProjection{ inverseView * camera.inversePerspective(aspect) };
 
 			Framebuffer& colorBuffer{ data.framebuffers.at(_colorBuffer) };
 			data.device.framebuffer().bind(colorBuffer);
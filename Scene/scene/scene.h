@@ -1,8 +1,10 @@
 #pragma once
 
 #include "core/repository.h"
+#include "core/transform_stream.h"
 #include "ecs/ecs.h"
 #include "render/render.h"
+#include "transform_system.h"
 
 namespace Byte {
 
@@ -10,12 +12,23 @@ namespace Byte {
 	private:
 		Repository _repository;
 		World _world;
+		Hierarchy<World> _hierarchy{ _world };
+		TransformSystem _transforms{ _hierarchy };
 		EntityID _mainCamera;
 		EntityID _mainLight;
 		AssetID _pointLightGroup{};
+		TransformStream _instanceStream;
+		std::vector<EntityID> _instanceIDs;
 
 	public:
 		Scene() {
+			_world.onAdd<PointLight>([this](World& world, const std::vector<EntityID>& ids) {
+				registerPointLights(world, ids);
+			});
+			_world.onAdd<Transform>([this](World& world, const std::vector<EntityID>& ids) {
+				registerPointLights(world, ids);
+			});
+
 			_mainCamera = _world.create<Camera, Transform>(Camera{}, Transform{});
 
 			_mainLight = _world.create<DirectionalLight, Transform>(DirectionalLight{}, Transform{});
@@ -32,7 +45,10 @@ namespace Byte {
 		}
 
 		void update(float dt) {
-			updatePointLights();
+			_world.nextTick();
+			_transforms.update(_world);
+			_world.dispatch();
+			updateInstances();
 		}
 
 		RenderContext renderContext() {
@@ -55,17 +71,53 @@ namespace Byte {
 			return _world;
 		}
 
+		Hierarchy<World>& hierarchy() {
+			return _hierarchy;
+		}
+
 		AssetID pointLightGroup() const {
 			return _pointLightGroup;
 		}
 
 	private:
-		void updatePointLights() {
+		void updateInstances() {
+			for (auto& [id, group] : _repository.instanceGroups()) {
+				if (!group.dynamic() || group.layout().stride() != TransformStream::INSTANCE_STRIDE * sizeof(float)) {
+					continue;
+				}
+
+				const std::vector<EntityID>& sources{ _world.related<RenderedBy>(id) };
+				_instanceStream.clear();
+				_instanceStream.reserve(sources.size());
+				_instanceIDs.clear();
+
+				const World& world{ _world };
+				for (EntityID source : sources) {
+					if (_world.has<Transform>(source)) {
+						_instanceStream.push(world.get<Transform>(source));
+						_instanceIDs.push_back(source);
+					}
+				}
+
+				group.submit(_instanceIDs, _instanceStream);
+			}
+		}
+
+		void registerPointLights(World& world, const std::vector<EntityID>& ids) {
 			InstanceGroup& group{ _repository.instanceGroup(_pointLightGroup) };
 
-			auto view{ _world.components<EntityID, PointLight, Transform>().exclude<InstanceRenderer>() };
-			Vector<EntityID> ids;
-			for (auto [id, pointLight, transform] : view) {
+			CommandBuffer<World> commands{ world };
+			for (EntityID id : ids) {
+				if (!world.contains(id)
+					|| !world.has<PointLight>(id)
+					|| !world.has<Transform>(id)
+					|| world.has<InstanceRenderer>(id)
+					|| group.contains(id)) {
+					continue;
+				}
+
+				PointLight& pointLight{ world.get<PointLight>(id) };
+				Transform& transform{ world.get<Transform>(id) };
 				transform.scale(transform.scale() * pointLight.radius());
 
 				group.submit(id, Vector<float>{
@@ -75,13 +127,10 @@ namespace Byte {
 						pointLight.constant, pointLight.linear, pointLight.quadratic
 				});
 
-				ids.push_back(id);
+				commands.attach(id, InstanceRenderer{ group.assetID() }, RenderedByGroup{ group.assetID() });
 			}
 
-			for (size_t idx{}; idx < ids.size(); ++idx) {
-				InstanceRenderer renderer{ group.assetID() };
-				_world.attach(ids[idx], std::move(renderer));
-			}
+			commands.playback();
 		}
 
 	};
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+#include "core/transform.h"
+#include "ecs/ecs.h"
+
+namespace Byte {
+
+	class TransformSystem {
+	public:
+		using Hierarchy = Byte::Hierarchy<World>;
+		using Node = Hierarchy::Node;
+		using Tree = Hierarchy::Tree;
+		using NodeMap = std::unordered_map<EntityID, uint32_t>;
+
+	private:
+		Hierarchy* _hierarchy;
+		NodeMap _nodeIndices;
+		std::vector<uint32_t> _nodeTrees;
+		std::vector<Transform*> _transforms;
+		std::vector<uint8_t> _updated;
+		std::vector<uint8_t> _dirty;
+		std::vector<Tree> _dirtyTrees;
+		std::vector<EntityID> _loose;
+		uint64_t _since{};
+		bool _rebuilt{};
+
+	public:
+		TransformSystem(Hierarchy& hierarchy)
+			: _hierarchy{ &hierarchy } {
+		}
+
+		void update(World& world) {
+			collect(world);
+			for (const Tree& tree : _dirtyTrees) {
+				propagate(tree);
+			}
+		}
+
+		void update(World& world, ThreadPool& pool) {
+			collect(world);
+			pool.parallel(_dirtyTrees.size(), [this](size_t _index) {
+				propagate(_dirtyTrees[_index]);
+			});
+		}
+
+	private:
+		void collect(World& world) {
+			_rebuilt = _hierarchy->dirty();
+			const std::vector<Node>& nodes{ _hierarchy->nodes() };
+			const std::vector<Tree>& trees{ _hierarchy->trees() };
+
+			_dirtyTrees.clear();
+			_loose.clear();
+
+			if (_rebuilt) {
+				index(nodes, trees);
+			}
+
+			_dirty.assign(trees.size(), _rebuilt);
+
+			for (auto [id, transform] : world.components<const EntityID, const Transform>().changedSince<Transform>(_since)) {
+				if (!transform.changed()) {
+					continue;
+				}
+
+				auto result{ _nodeIndices.find(id) };
+				if (result != _nodeIndices.end()) {
+					_dirty[_nodeTrees[result->second]] = 1;
+				}
+				else {
+					_loose.push_back(id);
+				}
+			}
+			_since = world.tick() - 1;
+
+			for (EntityID id : _loose) {
+				if (world.contains(id) && world.has<Transform>(id)) {
+					world.get<Transform>(id).propagate();
+				}
+			}
+
+			for (size_t tree{}; tree < trees.size(); ++tree) {
+				if (!_dirty[tree]) {
+					continue;
+				}
+
+				for (size_t _index{ trees[tree].first }; _index < trees[tree].first + trees[tree].count; ++_index) {
+					EntityID id{ nodes[_index].id };
+					bool valid{ world.contains(id) && world.has<Transform>(id) };
+					_transforms[_index] = valid ? &world.get<Transform>(id) : nullptr;
+					_updated[_index] = 0;
+				}
+				_dirtyTrees.push_back(trees[tree]);
+			}
+		}
+
+		void index(const std::vector<Node>& nodes, const std::vector<Tree>& trees) {
+			NodeMap previous{ std::move(_nodeIndices) };
+			_nodeIndices.clear();
+			_nodeTrees.resize(nodes.size());
+			_transforms.assign(nodes.size(), nullptr);
+			_updated.assign(nodes.size(), 0);
+
+			for (size_t tree{}; tree < trees.size(); ++tree) {
+				for (size_t _index{ trees[tree].first }; _index < trees[tree].first + trees[tree].count; ++_index) {
+					_nodeIndices.emplace(nodes[_index].id, static_cast<uint32_t>(_index));
+					_nodeTrees[_index] = static_cast<uint32_t>(tree);
+				}
+			}
+
+			// Entities that left every tree fall back to their local transform.
+			for (auto& pair : previous) {
+				if (!_nodeIndices.contains(pair.first)) {
+					_loose.push_back(pair.first);
+				}
+			}
+		}
+
+		void propagate(const Tree& tree) {
+			const std::vector<Node>& nodes{ _hierarchy->nodes() };
+
+			for (size_t _index{ tree.first }; _index < tree.first + tree.count; ++_index) {
+				Transform* transform{ _transforms[_index] };
+				uint32_t parent{ nodes[_index].parent };
+				bool parentUpdated{ parent != Hierarchy::NONE && _updated[parent] };
+
+				// Reparenting leaves the Transform untouched, so a rebuilt tree recomputes every node.
+				if (!transform || !(_rebuilt || transform->changed() || parentUpdated)) {
+					continue;
+				}
+
+				if (parent == Hierarchy::NONE || !_transforms[parent]) {
+					transform->propagate();
+				}
+				else {
+					transform->propagate(_transforms[parent]->global());
+				}
+				_updated[_index] = 1;
+			}
+		}
+
+	};
+
+}
\ No newline at end of file
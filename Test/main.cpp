@@ -0,0 +1,20 @@
+#include "test.h"
+#include "world_test.h"
+#include "scheduler_test.h"
+#include "relation_test.h"
+#include "staging_test.h"
+#include "snapshot_test.h"
+#include "slot_map_test.h"
+#include "command_buffer_test.h"
+#include "observer_test.h"
+#include "transform_stream_test.h"
+#include "transform_test.h"
+#include "hash_map_test.h"
+#include "serializer_test.h"
+#include "sparse_test.h"
+
+using namespace Byte;
+
+int main() {
+	return TestRegistry::run();
+}
\ No newline at end of file
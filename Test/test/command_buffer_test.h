@@ -0,0 +1,138 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ecs/ecs.h"
+#include "test.h"
+#include "world_test.h"
+#include "snapshot_test.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	void checkBatchRelocation() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		std::vector<EntityID> ids;
+		for (size_t _index{}; _index < 3000; ++_index) {
+			ids.push_back(world.create(TestPosition{ static_cast<float>(_index) }, TestName{ std::to_string(_index) }));
+		}
+
+		CommandBuffer<WorldType> commands{ world };
+		for (size_t _index{ 500 }; _index < 1500; ++_index) {
+			commands.attach(ids[_index], TestVelocity{ static_cast<float>(_index) });
+		}
+		for (size_t _index{}; _index < 3000; ++_index) {
+			if (_index % 3 == 0 || _index >= 2800) {
+				commands.destroy(ids[_index]);
+			}
+		}
+		commands.playback();
+
+		for (size_t _index{}; _index < 3000; ++_index) {
+			bool destroyed{ _index % 3 == 0 || _index >= 2800 };
+			BYTE_CHECK(world.contains(ids[_index]) != destroyed);
+			if (destroyed) {
+				continue;
+			}
+
+			BYTE_CHECK(world.template get<TestPosition>(ids[_index]).x == static_cast<float>(_index));
+			BYTE_CHECK(world.template get<TestName>(ids[_index]).value == std::to_string(_index));
+			BYTE_CHECK(world.template has<TestVelocity>(ids[_index]) == (_index >= 500 && _index < 1500));
+		}
+	}
+
+	BYTE_TEST(batchRelocation) {
+		checkBatchRelocation<VectorWorld>();
+		checkBatchRelocation<World>();
+		checkBatchRelocation<DenseWorld>();
+	}
+
+	template<typename WorldType>
+	void checkCommandOrdering() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		EntityID detached{ world.create(TestPosition{ 1.0f }) };
+		EntityID replaced{ world.create(TestPosition{ 2.0f }) };
+		EntityID restored{ world.create(TestPosition{ 3.0f }, TestVelocity{ 1.0f }) };
+		EntityID doomed{ world.create(TestPosition{ 4.0f }) };
+
+		CommandBuffer<WorldType> commands{ world };
+		commands.attach(detached, TestVelocity{ 1.0f });
+		commands.template detach<TestVelocity>(detached);
+		commands.attach(replaced, TestVelocity{ 1.0f });
+		commands.attach(replaced, TestVelocity{ 2.0f });
+		commands.template detach<TestVelocity>(restored);
+		commands.attach(restored, TestVelocity{ 3.0f });
+		commands.attach(doomed, TestVelocity{ 4.0f });
+		commands.destroy(doomed);
+
+		EntityID created{ commands.create(TestPosition{ 5.0f }) };
+		commands.attach(created, TestVelocity{ 5.0f });
+		EntityID discarded{ commands.create() };
+		commands.destroy(discarded);
+
+		BYTE_CHECK(!world.contains(created));
+		BYTE_CHECK(!commands.empty());
+		commands.playback();
+		BYTE_CHECK(commands.empty());
+
+		BYTE_CHECK(!world.template has<TestVelocity>(detached));
+		BYTE_CHECK(world.template get<TestVelocity>(replaced).x == 2.0f);
+		BYTE_CHECK(world.template get<TestVelocity>(restored).x == 3.0f);
+		BYTE_CHECK(world.template get<TestPosition>(restored).x == 3.0f);
+		BYTE_CHECK(!world.contains(doomed));
+		BYTE_CHECK(world.template get<TestPosition>(created).x == 5.0f);
+		BYTE_CHECK(world.template get<TestVelocity>(created).x == 5.0f);
+		BYTE_CHECK(!world.contains(discarded));
+	}
+
+	BYTE_TEST(commandOrdering) {
+		checkCommandOrdering<VectorWorld>();
+		checkCommandOrdering<World>();
+		checkCommandOrdering<DenseWorld>();
+	}
+
+	template<typename WorldType>
+	void checkPresentAttach() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		EntityID direct{ world.create(TestPosition{ 1.0f }, TestName{ "a" }) };
+		EntityID neighbour{ world.create(TestPosition{ 2.0f }, TestName{ "b" }) };
+		world.attach(direct, TestName{ "x" }, TestVelocity{ 3.0f });
+
+		BYTE_CHECK(world.template get<TestPosition>(direct).x == 1.0f);
+		BYTE_CHECK(world.template get<TestName>(direct).value == "x");
+		BYTE_CHECK(world.template get<TestVelocity>(direct).x == 3.0f);
+		BYTE_CHECK(world.template get<TestName>(neighbour).value == "b");
+
+		EntityID named{ world.create(TestPosition{ 4.0f }, TestName{ "c" }) };
+		EntityID bare{ world.create(TestPosition{ 5.0f }) };
+
+		CommandBuffer<WorldType> commands{ world };
+		commands.attach(named, TestName{ "y" }, TestVelocity{ 4.0f });
+		commands.attach(neighbour, TestVelocity{ 2.0f });
+		commands.attach(bare, TestName{ "z" }, TestVelocity{ 5.0f });
+		commands.playback();
+
+		BYTE_CHECK(world.template get<TestPosition>(named).x == 4.0f);
+		BYTE_CHECK(world.template get<TestName>(named).value == "y");
+		BYTE_CHECK(world.template get<TestVelocity>(named).x == 4.0f);
+		BYTE_CHECK(world.template get<TestName>(neighbour).value == "b");
+		BYTE_CHECK(world.template get<TestVelocity>(neighbour).x == 2.0f);
+		BYTE_CHECK(world.template get<TestPosition>(bare).x == 5.0f);
+		BYTE_CHECK(world.template get<TestName>(bare).value == "z");
+		BYTE_CHECK(world.template get<TestVelocity>(bare).x == 5.0f);
+	}
+
+	BYTE_TEST(presentAttach) {
+		checkPresentAttach<VectorWorld>();
+		checkPresentAttach<World>();
+		checkPresentAttach<DenseWorld>();
+	}
+
+}
\ No newline at end of file
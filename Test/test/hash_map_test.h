@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ecs/hash_map.h"
+#include "test.h"
+
+namespace Byte {
+
+	struct TestCollidingHash {
+		size_t operator()(uint64_t key) const {
+			return static_cast<size_t>(key % 7);
+		}
+	};
+
+	template<typename Map>
+	bool sameContents(const Map& map, const std::unordered_map<uint64_t, uint64_t>& reference) {
+		if (map.size() != reference.size()) {
+			return false;
+		}
+
+		for (auto& [key, value] : reference) {
+			auto result{ map.find(key) };
+			if (result == map.end() || result->second != value) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename Map>
+	void checkHashMapChurn(size_t count) {
+		Map map;
+		std::unordered_map<uint64_t, uint64_t> reference;
+
+		for (uint64_t key{}; key < count; ++key) {
+			map.emplace(key, key * 3);
+			reference.emplace(key, key * 3);
+		}
+		BYTE_CHECK(sameContents(map, reference));
+
+		uint64_t next{ count };
+		for (uint64_t round{ 1 }; round <= 20; ++round) {
+			std::vector<uint64_t> victims;
+			for (auto& [key, value] : reference) {
+				if ((key + round) % 3 == 0) {
+					victims.push_back(key);
+				}
+			}
+
+			for (uint64_t key : victims) {
+				map.erase(key);
+				reference.erase(key);
+			}
+			for (size_t _index{}; _index < victims.size(); ++_index, ++next) {
+				map.emplace(next, next * 3);
+				reference.emplace(next, next * 3);
+			}
+			map.erase(next);
+		}
+
+		BYTE_CHECK(sameContents(map, reference));
+		BYTE_CHECK(map.load_factor() > 0.2f);
+		BYTE_CHECK(!map.contains(next));
+
+		for (auto& [key, value] : reference) {
+			map.erase(key);
+		}
+		BYTE_CHECK(map.size() == 0);
+		BYTE_CHECK(map.find(0) == map.end());
+	}
+
+	BYTE_TEST(hashMapTombstones) {
+		checkHashMapChurn<hash_map<uint64_t, uint64_t>>(1000);
+		checkHashMapChurn<hash_map<uint64_t, uint64_t, TestCollidingHash>>(200);
+	}
+
+	BYTE_TEST(hashMapRehash) {
+		hash_map<uint64_t, uint64_t> map;
+		std::unordered_map<uint64_t, uint64_t> reference;
+		map.reserve(10);
+
+		for (uint64_t key{}; key < 5000; ++key) {
+			map[key * 7919] = key;
+			reference[key * 7919] = key;
+		}
+		BYTE_CHECK(sameContents(map, reference));
+		BYTE_CHECK(map.load_factor() <= 0.875f);
+
+		map.clear();
+		BYTE_CHECK(map.size() == 0);
+		BYTE_CHECK(!map.contains(7919));
+		map.emplace(7919, 1);
+		BYTE_CHECK(map.at(7919) == 1);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>
+
+#include "ecs/ecs.h"
+#include "test.h"
+#include "world_test.h"
+#include "scheduler_test.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	void checkObserverEvents() {
+		using EntityID = typename WorldType::EntityID;
+		using IDVector = std::vector<EntityID>;
+
+		WorldType world;
+		IDVector added;
+		IDVector removed;
+		IDVector changed;
+		IDVector tagged;
+		world.template onAdd<TestVelocity>([&](WorldType&, const IDVector& ids) {
+			added.insert(added.end(), ids.begin(), ids.end());
+		});
+		world.template onRemove<TestVelocity>([&](WorldType&, const IDVector& ids) {
+			removed.insert(removed.end(), ids.begin(), ids.end());
+		});
+		world.template onChange<TestVelocity>([&](WorldType&, const IDVector& ids) {
+			changed.insert(changed.end(), ids.begin(), ids.end());
+		});
+		world.template onChange<TestTag>([&](WorldType&, const IDVector& ids) {
+			tagged.insert(tagged.end(), ids.begin(), ids.end());
+		});
+
+		EntityID moving{ world.create(TestPosition{}, TestVelocity{}) };
+		EntityID still{ world.create(TestPosition{}) };
+		BYTE_CHECK(added.empty());
+
+		world.template modified<TestVelocity>(moving);
+		world.template modified<TestVelocity>(still);
+		world.template modified<TestTag>(still);
+		world.dispatch();
+		BYTE_CHECK(added == IDVector{ moving });
+		BYTE_CHECK(changed == IDVector{ moving });
+		BYTE_CHECK(tagged.empty());
+
+		world.attach(still, TestTag{});
+		world.template modified<TestTag>(still);
+		world.template detach<TestVelocity>(moving);
+		world.dispatch();
+		BYTE_CHECK(tagged == IDVector{ still });
+		BYTE_CHECK(removed == IDVector{ moving });
+		BYTE_CHECK(changed.size() == 1);
+	}
+
+	BYTE_TEST(observerEvents) {
+		checkObserverEvents<VectorWorld>();
+		checkObserverEvents<World>();
+	}
+
+	template<typename WorldType>
+	void checkObserverBatching() {
+		using EntityID = typename WorldType::EntityID;
+		using IDVector = std::vector<EntityID>;
+
+		WorldType world;
+		IDVector added;
+		IDVector removed;
+		IDVector changed;
+		world.template onAdd<TestVelocity>([&](WorldType&, const IDVector& ids) {
+			added.insert(added.end(), ids.begin(), ids.end());
+		});
+		world.template onRemove<TestVelocity>([&](WorldType&, const IDVector& ids) {
+			removed.insert(removed.end(), ids.begin(), ids.end());
+		});
+		world.template onChange<TestVelocity>([&](WorldType&, const IDVector& ids) {
+			changed.insert(changed.end(), ids.begin(), ids.end());
+		});
+
+		EntityID first{ world.create(TestPosition{}) };
+		EntityID second{ world.create(TestPosition{}) };
+		EntityID doomed{ world.create(TestPosition{}) };
+
+		world.attach(first, TestVelocity{});
+		world.attach(second, TestVelocity{});
+		world.attach(doomed, TestVelocity{});
+		world.template detach<TestVelocity>(first);
+		world.attach(first, TestVelocity{});
+		for (size_t _index{}; _index < 3; ++_index) {
+			world.template modified<TestVelocity>(second);
+			world.template modified<TestVelocity>(doomed);
+			world.template modified<TestVelocity>(first);
+		}
+		world.destroy(doomed);
+		world.dispatch();
+
+		BYTE_CHECK((added == IDVector{ first, second }));
+		BYTE_CHECK((changed == IDVector{ second, first }));
+		BYTE_CHECK((removed == IDVector{ first, doomed }));
+	}
+
+	BYTE_TEST(observerBatching) {
+		checkObserverBatching<VectorWorld>();
+		checkObserverBatching<World>();
+		checkObserverBatching<DenseWorld>();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ecs/ecs.h"
+#include "test.h"
+
+namespace Byte {
+
+	struct TestOwnedBy {};
+
+	using TestOwner = Relation<TestOwnedBy, int>;
+
+	BYTE_TEST(relationRetarget) {
+		World world;
+		EntityID first{ world.create(TestOwner{ 1 }) };
+		EntityID second{ world.create(TestOwner{ 1 }) };
+		BYTE_CHECK(world.related<TestOwnedBy>(1).size() == 2);
+
+		world.get<TestOwner>(first).target = 2;
+		world.modified<TestOwner>(first);
+		BYTE_CHECK(world.related<TestOwnedBy>(1).size() == 1);
+		BYTE_CHECK(world.related<TestOwnedBy>(2).size() == 1);
+
+		world.get<TestOwner>(second).target = 3;
+		world.detach<TestOwner>(second);
+		BYTE_CHECK(world.related<TestOwnedBy>(1).empty());
+		BYTE_CHECK(world.related<TestOwnedBy>(3).empty());
+
+		world.destroy(first);
+		BYTE_CHECK(world.related<TestOwnedBy>(2).empty());
+		BYTE_CHECK(world.sparse<TestOwner>().lookup().targetCount() == 0);
+	}
+
+}
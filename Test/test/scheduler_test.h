@@ -0,0 +1,129 @@
+#pragma once
+
+#include "ecs/ecs.h"
+#include "test.h"
+
+namespace Byte {
+
+	struct TestHealth {
+		int value{};
+	};
+
+	struct TestArmor {
+		int value{};
+	};
+
+	struct TestTag {
+		int value{};
+	};
+
+	template<>
+	struct ComponentStorage<TestTag> {
+		inline static constexpr bool SPARSE{ true };
+	};
+
+	// Two writers over one archetype run in the same stage. Build with
+	// -fsanitize=thread to check that view iteration never mutates shared state.
+	template<typename WorldType>
+	void checkParallelWriters() {
+		WorldType world;
+		for (int _index{}; _index < 20000; ++_index) {
+			world.create(TestHealth{}, TestArmor{});
+		}
+		WorldType snapshot{ world };
+
+		Scheduler<WorldType> scheduler{ 2 };
+		scheduler.template system<Read<TestTag>, Write<TestHealth>>([](WorldType& world, ThreadPool&) {
+			for (auto [health] : world.template components<TestHealth>()) {
+				++health.value;
+			}
+			for ([[maybe_unused]] auto [health, tag] : world.template components<const TestHealth, const TestTag>()) {
+			}
+		});
+		scheduler.template system<Read<TestTag>, Write<TestArmor>>([](WorldType& world, ThreadPool&) {
+			for (auto [armor] : world.template components<TestArmor>()) {
+				armor.value += 2;
+			}
+			for ([[maybe_unused]] auto [armor, tag] : world.template components<const TestArmor, const TestTag>()) {
+			}
+		});
+		BYTE_CHECK(scheduler.stageCount() == 1);
+
+		for (size_t frame{}; frame < 4; ++frame) {
+			world.nextTick();
+			scheduler.run(world);
+		}
+
+		bool updated{ true };
+		for (auto [health, armor] : world.template components<const TestHealth, const TestArmor>()) {
+			updated = updated && health.value == 4 && armor.value == 8;
+		}
+		BYTE_CHECK(updated);
+
+		bool untouched{ true };
+		for (auto [health, armor] : snapshot.template components<const TestHealth, const TestArmor>()) {
+			untouched = untouched && health.value == 0 && armor.value == 0;
+		}
+		BYTE_CHECK(untouched);
+	}
+
+	BYTE_TEST(parallelWriters) {
+		checkParallelWriters<VectorWorld>();
+		checkParallelWriters<World>();
+		checkParallelWriters<DenseWorld>();
+	}
+
+	// A single system fans out over the pool on a world whose columns are
+	// still shared with a snapshot. Every chunk task must find its column
+	// already detached.
+	template<typename WorldType>
+	void checkSharedChunkFanOut() {
+		WorldType world;
+		for (int _index{}; _index < 40000; ++_index) {
+			world.create(TestHealth{ _index }, TestArmor{});
+		}
+		WorldType snapshot{ world };
+		const WorldType& frozen{ snapshot };
+
+		Scheduler<WorldType> scheduler{ 4 };
+		scheduler.template system<Read<TestArmor>, Write<TestHealth>>([](WorldType& world, ThreadPool& pool) {
+			world.template components<TestHealth, const TestArmor>().eachChunk(pool, [](size_t count, TestHealth* health, const TestArmor*) {
+				for (size_t _index{}; _index < count; ++_index) {
+					health[_index].value += 1;
+				}
+			});
+		});
+		BYTE_CHECK(scheduler.stageCount() == 1);
+
+		world.nextTick();
+		scheduler.run(world);
+
+		ThreadPool pool{ 4 };
+		world.template components<TestArmor>().eachChunk(pool, [](size_t count, TestArmor* armor) {
+			for (size_t _index{}; _index < count; ++_index) {
+				armor[_index].value = 7;
+			}
+		});
+
+		bool updated{ true };
+		for (auto [id, health, armor] : world.template components<const typename WorldType::EntityID, const TestHealth, const TestArmor>()) {
+			updated = updated && health.value == frozen.template get<TestHealth>(id).value + 1 && armor.value == 7;
+		}
+		BYTE_CHECK(updated);
+
+		bool untouched{ true };
+		int expected{};
+		for (auto [health, armor] : snapshot.template components<const TestHealth, const TestArmor>()) {
+			untouched = untouched && health.value == expected++ && armor.value == 0;
+		}
+		BYTE_CHECK(untouched);
+		BYTE_CHECK(expected == 40000);
+	}
+
+	BYTE_TEST(sharedChunkFanOut) {
+		checkSharedChunkFanOut<VectorWorld>();
+		checkSharedChunkFanOut<World>();
+		checkSharedChunkFanOut<DenseWorld>();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "ecs/ecs.h"
+#include "test.h"
+#include "world_test.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	void checkSerializerRoundTrip(const std::string& name) {
+		using EntityID = typename WorldType::EntityID;
+
+		std::string path{ (std::filesystem::temp_directory_path() / name).string() };
+
+		WorldType world;
+		std::vector<EntityID> ids;
+		for (size_t _index{}; _index < 5000; ++_index) {
+			if (_index % 2) {
+				ids.push_back(world.create(TestPosition{ static_cast<float>(_index) }, TestVelocity{ -static_cast<float>(_index) }));
+			}
+			else {
+				ids.push_back(world.create(TestPosition{ static_cast<float>(_index) }));
+			}
+		}
+		for (size_t _index{}; _index < 5000; _index += 7) {
+			world.destroy(ids[_index]);
+		}
+		EntityID loose{ world.create() };
+
+		Serializer<WorldType>::template save<TestPosition, TestVelocity>(world, path);
+
+		{
+			WorldType loaded{ Serializer<WorldType>::template load<TestPosition, TestVelocity>(path) };
+			BYTE_CHECK(loaded.size() == world.size());
+			BYTE_CHECK(loaded.contains(loose));
+
+			for (size_t _index{}; _index < 5000; ++_index) {
+				bool destroyed{ _index % 7 == 0 };
+				BYTE_CHECK(loaded.contains(ids[_index]) != destroyed);
+				if (destroyed) {
+					continue;
+				}
+
+				BYTE_CHECK(loaded.template get<TestPosition>(ids[_index]).x == static_cast<float>(_index));
+				BYTE_CHECK(loaded.template has<TestVelocity>(ids[_index]) == (_index % 2 == 1));
+				if (_index % 2) {
+					BYTE_CHECK(loaded.template get<TestVelocity>(ids[_index]).x == -static_cast<float>(_index));
+				}
+			}
+
+			loaded.template get<TestPosition>(ids[1]).x = 42.0f;
+			loaded.attach(ids[2], TestVelocity{ 2.0f });
+			loaded.destroy(ids[3]);
+			BYTE_CHECK(loaded.template get<TestPosition>(ids[1]).x == 42.0f);
+			BYTE_CHECK(loaded.template get<TestVelocity>(ids[2]).x == 2.0f);
+			BYTE_CHECK(!loaded.contains(ids[3]));
+			BYTE_CHECK(world.template get<TestPosition>(ids[1]).x == 1.0f);
+		}
+
+		std::filesystem::remove(path);
+	}
+
+	BYTE_TEST(serializerRoundTrip) {
+		checkSerializerRoundTrip<VectorWorld>("byte_serializer_vector.bin");
+		checkSerializerRoundTrip<World>("byte_serializer_chunked.bin");
+	}
+
+}
\ No newline at end of file
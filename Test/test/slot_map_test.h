@@ -0,0 +1,86 @@
+#pragma once
+
+#include "ecs/ecs.h"
+#include "test.h"
+
+namespace Byte {
+
+	BYTE_TEST(slotMapVersions) {
+		slot_map<GenerationalID, int> map;
+		GenerationalID first{ map.generate() };
+		map.emplace(first, 1);
+		GenerationalID second{ map.generate() };
+		map.emplace(second, 2);
+		BYTE_CHECK(first.version == 1 && second.index == first.index + 1);
+
+		map.erase(first);
+		BYTE_CHECK(!map.contains(first));
+		BYTE_CHECK(map.size() == 1);
+
+		GenerationalID reused{ map.generate() };
+		BYTE_CHECK(reused.index == first.index && reused.version == first.version + 1);
+		map.emplace(reused, 3);
+		BYTE_CHECK(map.at(reused) == 3);
+		BYTE_CHECK(!map.contains(first));
+		BYTE_CHECK(map.find(first) == map.end());
+	}
+
+	BYTE_TEST(slotMapReservations) {
+		slot_map<GenerationalID, int> map;
+		GenerationalID first{ map.generate() };
+		map.emplace(first, 1);
+		map.erase(first);
+
+		GenerationalID reserved{ map.reserve_key() };
+		BYTE_CHECK(reserved.index == first.index && reserved.version == first.version + 1);
+
+		GenerationalID fresh{ map.reserve_key() };
+		BYTE_CHECK(fresh.index != reserved.index);
+
+		GenerationalID generated{ map.generate() };
+		BYTE_CHECK(generated.index != reserved.index && generated.index != fresh.index);
+
+		map.release_key(reserved);
+		map.release_key(reserved);
+		map.emplace(fresh, 2);
+		BYTE_CHECK(map.at(fresh) == 2);
+
+		GenerationalID recycled{ map.generate() };
+		BYTE_CHECK(recycled.index == reserved.index && recycled.version == reserved.version + 1);
+		BYTE_CHECK(map.generate().index != recycled.index);
+	}
+
+	template<typename WorldType>
+	void checkAbandonedReservations() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		EntityID first{ world.create() };
+		world.destroy(first);
+
+		for (size_t _index{}; _index < 100; ++_index) {
+			CommandBuffer<WorldType> commands{ world };
+			commands.create(TestPosition{});
+		}
+
+		CommandBuffer<WorldType> cleared{ world };
+		cleared.create();
+		cleared.clear();
+
+		{
+			Staging<WorldType> staging{ world };
+			staging.lane().create(TestPosition{});
+		}
+
+		EntityID next{ world.create() };
+		BYTE_CHECK(next.index == first.index);
+		BYTE_CHECK(world.create().index == first.index + 1);
+		BYTE_CHECK(world.size() == 2);
+	}
+
+	BYTE_TEST(abandonedReservations) {
+		checkAbandonedReservations<DenseVectorWorld>();
+		checkAbandonedReservations<DenseWorld>();
+	}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+
+#include "ecs/ecs.h"
+#include "test.h"
+
+namespace Byte {
+
+	struct TestMass {
+		float value{};
+	};
+
+	struct TestName {
+		std::string value;
+	};
+
+	template<typename WorldType>
+	void checkSnapshotIsolation() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		EntityID first{ world.create(TestMass{ 1.0f }, TestName{ "first" }) };
+		EntityID second{ world.create(TestMass{ 2.0f }, TestName{ "second" }) };
+
+		WorldType snapshot{ world };
+		world.template get<TestMass>(first).value = 10.0f;
+		world.template get<TestName>(second).value = "changed";
+		world.template detach<TestName>(first);
+		EntityID third{ world.create(TestMass{ 3.0f }) };
+
+		BYTE_CHECK(snapshot.size() == 2);
+		BYTE_CHECK(!snapshot.contains(third));
+		BYTE_CHECK(snapshot.template get<TestMass>(first).value == 1.0f);
+		BYTE_CHECK(snapshot.template get<TestName>(first).value == "first");
+		BYTE_CHECK(snapshot.template get<TestName>(second).value == "second");
+
+		snapshot.template get<TestMass>(second).value = 20.0f;
+		snapshot.destroy(first);
+		BYTE_CHECK(world.template get<TestMass>(second).value == 2.0f);
+		BYTE_CHECK(world.contains(first));
+		BYTE_CHECK(world.size() == 3);
+
+		world = snapshot;
+		BYTE_CHECK(world.size() == 1);
+		BYTE_CHECK(world.template get<TestMass>(second).value == 20.0f);
+	}
+
+	BYTE_TEST(snapshotIsolation) {
+		checkSnapshotIsolation<VectorWorld>();
+		checkSnapshotIsolation<World>();
+		checkSnapshotIsolation<DenseVectorWorld>();
+		checkSnapshotIsolation<DenseWorld>();
+	}
+
+	// Shared columns hand out the same address to both worlds until one of
+	// them writes, so equal addresses mean a read did not detach.
+	template<typename WorldType>
+	void checkConstReadKeepsShared() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		EntityID id{ world.create(TestMass{ 1.0f }, TestName{ "shared" }) };
+		WorldType snapshot{ world };
+
+		const WorldType& original{ world };
+		const WorldType& frozen{ snapshot };
+		BYTE_CHECK(frozen.template get<TestMass>(id).value == 1.0f);
+		BYTE_CHECK(frozen.template get<TestName>(id).value == "shared");
+		BYTE_CHECK(&frozen.template get<TestMass>(id) == &original.template get<TestMass>(id));
+		BYTE_CHECK(&frozen.template get<TestName>(id) == &original.template get<TestName>(id));
+
+		world.template get<TestMass>(id).value = 2.0f;
+		BYTE_CHECK(&frozen.template get<TestMass>(id) != &original.template get<TestMass>(id));
+		BYTE_CHECK(frozen.template get<TestMass>(id).value == 1.0f);
+	}
+
+	BYTE_TEST(constReadKeepsShared) {
+		checkConstReadKeepsShared<VectorWorld>();
+		checkConstReadKeepsShared<World>();
+		checkConstReadKeepsShared<DenseVectorWorld>();
+		checkConstReadKeepsShared<DenseWorld>();
+	}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+
+#include "ecs/ecs.h"
+#include "test.h"
+#include "scheduler_test.h"
+
+namespace Byte {
+
+	template<typename WorldType>
+	void checkSparseToggling() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		std::vector<EntityID> ids;
+		for (int _index{}; _index < 1000; ++_index) {
+			ids.push_back(world.create(TestHealth{ _index }));
+		}
+		const TestHealth* first{ &world.template get<TestHealth>(ids.front()) };
+
+		auto before{ world.stats() };
+		for (int round{}; round < 10; ++round) {
+			for (size_t _index{}; _index < ids.size(); ++_index) {
+				if ((_index + round) % 2 == 0) {
+					world.attach(ids[_index], TestTag{ round });
+				}
+			}
+
+			int tagged{};
+			bool joined{ true };
+			for (auto [id, health, tag] : world.template components<const EntityID, const TestHealth, const TestTag>()) {
+				joined = joined && tag.value == round && world.template get<TestHealth>(id).value == health.value;
+				++tagged;
+			}
+			BYTE_CHECK(tagged == 500);
+			BYTE_CHECK(joined);
+
+			for (size_t _index{}; _index < ids.size(); ++_index) {
+				if (world.template has<TestTag>(ids[_index])) {
+					world.template detach<TestTag>(ids[_index]);
+				}
+			}
+			BYTE_CHECK(!world.template has<TestTag>(ids.front()));
+		}
+
+		auto after{ world.stats() };
+		BYTE_CHECK(after.archetypes == before.archetypes);
+		BYTE_CHECK(after.total.moves == before.total.moves);
+		BYTE_CHECK(&world.template get<TestHealth>(ids.front()) == first);
+
+		bool untouched{ true };
+		for (size_t _index{}; _index < ids.size(); ++_index) {
+			untouched = untouched && world.template get<TestHealth>(ids[_index]).value == static_cast<int>(_index);
+		}
+		BYTE_CHECK(untouched);
+	}
+
+	BYTE_TEST(sparseToggling) {
+		checkSparseToggling<VectorWorld>();
+		checkSparseToggling<World>();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <unordered_set>
+
+#include "ecs/ecs.h"
+#include "test.h"
+
+namespace Byte {
+
+	struct TestCounter {
+		int value{};
+	};
+
+	template<typename WorldType>
+	void checkStagingLanes() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		world.create(TestCounter{ -1 });
+
+		Staging<WorldType> staging{ world };
+		std::vector<std::vector<EntityID>> created(4);
+		std::vector<std::thread> threads;
+		for (size_t lane{}; lane < created.size(); ++lane) {
+			typename Staging<WorldType>::Lane& target{ staging.lane() };
+			threads.emplace_back([&target, &created, lane]() {
+				for (int _index{}; _index < 2500; ++_index) {
+					created[lane].push_back(target.create(TestCounter{ _index }));
+				}
+			});
+		}
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		BYTE_CHECK(staging.size() == 10000);
+		staging.merge();
+		BYTE_CHECK(world.size() == 10001);
+
+		std::unordered_set<EntityID> unique;
+		bool valid{ true };
+		for (const std::vector<EntityID>& ids : created) {
+			for (size_t _index{}; _index < ids.size(); ++_index) {
+				unique.insert(ids[_index]);
+				valid = valid && static_cast<bool>(ids[_index])
+					&& world.contains(ids[_index])
+					&& world.template get<TestCounter>(ids[_index]).value == static_cast<int>(_index);
+			}
+		}
+		BYTE_CHECK(valid);
+		BYTE_CHECK(unique.size() == 10000);
+	}
+
+	BYTE_TEST(stagingLanes) {
+		checkStagingLanes<VectorWorld>();
+		checkStagingLanes<DenseVectorWorld>();
+		checkStagingLanes<DenseWorld>();
+	}
+
+	BYTE_TEST(entityIDSeeds) {
+		EntityID first{};
+		EntityID second{};
+		std::thread([&first]() { first = EntityIDGenerator<EntityID>::generate(); }).join();
+		std::thread([&second]() { second = EntityIDGenerator<EntityID>::generate(); }).join();
+		BYTE_CHECK(first && second && first != second);
+	}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <iostream>
+
+namespace Byte {
+
+	class TestRegistry {
+	private:
+		struct Test {
+			const char* name;
+			void (*function)();
+		};
+
+		inline static std::vector<Test> _tests;
+		inline static size_t _failures{};
+
+	public:
+		static bool add(const char* name, void (*function)()) {
+			_tests.push_back(Test{ name, function });
+			return true;
+		}
+
+		static void fail(const char* expression, const char* file, int line) {
+			++_failures;
+			std::cerr << file << "(" << line << "): check failed: " << expression << "\n";
+		}
+
+		static int run() {
+			for (const Test& test : _tests) {
+				size_t failures{ _failures };
+				test.function();
+				std::cout << (failures == _failures ? "[pass] " : "[fail] ") << test.name << "\n";
+			}
+
+			std::cout << _tests.size() << " tests, " << _failures << " failed checks\n";
+			return _failures == 0 ? 0 : 1;
+		}
+	};
+
+}
+
+#define BYTE_TEST(name) \
+	static void name(); \
+	inline const bool name##Registered{ Byte::TestRegistry::add(#name, &name) }; \
+	static void name()
+
+#define BYTE_CHECK(expression) \
+	((expression) ? void() : Byte::TestRegistry::fail(#expression, __FILE__, __LINE__))
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "core/transform_stream.h"
+#include "test.h"
+
+namespace Byte {
+
+	BYTE_TEST(transformStreamPack) {
+		constexpr float GUARD{ -1234.0f };
+		constexpr size_t STRIDE{ TransformStream::INSTANCE_STRIDE };
+
+		for (size_t count{}; count <= 9; ++count) {
+			TransformStream stream;
+			for (size_t _index{}; _index < count; ++_index) {
+				float base{ static_cast<float>(_index * STRIDE) };
+				stream.push(TransformData{
+					Vec3{ base, base + 1.0f, base + 2.0f },
+					Vec3{ base + 3.0f, base + 4.0f, base + 5.0f },
+					Quaternion{ base + 9.0f, base + 6.0f, base + 7.0f, base + 8.0f } });
+			}
+
+			std::vector<float> out(count * STRIDE + STRIDE, GUARD);
+			stream.pack(out.data());
+
+			for (size_t _index{}; _index < count * STRIDE; ++_index) {
+				BYTE_CHECK(out[_index] == static_cast<float>(_index));
+			}
+			for (size_t _index{ count * STRIDE }; _index < out.size(); ++_index) {
+				BYTE_CHECK(out[_index] == GUARD);
+			}
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "core/transform.h"
+#include "scene/transform_system.h"
+#include "test.h"
+
+namespace Byte {
+
+	inline bool nearlyEqual(const Mat4& left, const Mat4& right) {
+		for (size_t _index{}; _index < 16; ++_index) {
+			if (std::abs(left.data[_index] - right.data[_index]) > 1e-4f) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	inline bool nearlyEqual(const Vec3& left, const Vec3& right) {
+		return std::abs(left.x - right.x) < 1e-4f
+			&& std::abs(left.y - right.y) < 1e-4f
+			&& std::abs(left.z - right.z) < 1e-4f;
+	}
+
+	BYTE_TEST(transformCacheReads) {
+		std::vector<Transform> transforms(256);
+		for (size_t _index{}; _index < transforms.size(); ++_index) {
+			float offset{ static_cast<float>(_index) };
+			transforms[_index].localPosition(Vec3{ offset, 2.0f * offset, -offset });
+			transforms[_index].localScale(Vec3{ 1.0f, 2.0f, 0.5f });
+			transforms[_index].localRotation(Quaternion{ Vec3{ 0.1f * offset, 0.2f, 0.3f } });
+			transforms[_index].propagate();
+		}
+
+		std::vector<std::thread> readers;
+		std::vector<size_t> mismatches(4);
+		for (size_t reader{}; reader < mismatches.size(); ++reader) {
+			readers.emplace_back([&transforms, &mismatches, reader]() {
+				for (const Transform& transform : transforms) {
+					Mat4 expected{ composeTRS(transform.global()) };
+					if (!nearlyEqual(transform.model(), expected)
+						|| !nearlyEqual(transform.inverseModel(), expected.inverse())) {
+						++mismatches[reader];
+					}
+				}
+			});
+		}
+
+		for (std::thread& reader : readers) {
+			reader.join();
+		}
+
+		for (size_t mismatch : mismatches) {
+			BYTE_CHECK(mismatch == 0);
+		}
+	}
+
+	BYTE_TEST(hierarchyPropagation) {
+		World world;
+		Hierarchy<World> hierarchy{ world };
+		TransformSystem system{ hierarchy };
+		ThreadPool pool{ 2 };
+
+		EntityID root{ world.create(Transform{}) };
+		EntityID child{ world.create(Transform{}) };
+		EntityID grandchild{ world.create(Transform{}) };
+		EntityID loose{ world.create(Transform{}) };
+		hierarchy.attach(child, root);
+		hierarchy.attach(grandchild, child);
+
+		world.get<Transform>(root).localPosition(Vec3{ 1.0f, 0.0f, 0.0f });
+		world.get<Transform>(root).localScale(Vec3{ 2.0f, 2.0f, 2.0f });
+		world.get<Transform>(child).localPosition(Vec3{ 1.0f, 0.0f, 0.0f });
+		world.get<Transform>(grandchild).localPosition(Vec3{ 0.0f, 1.0f, 0.0f });
+		world.get<Transform>(loose).localPosition(Vec3{ 5.0f, 0.0f, 0.0f });
+		world.nextTick();
+		system.update(world);
+
+		const World& view{ world };
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).position(), Vec3{ 3.0f, 0.0f, 0.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(grandchild).position(), Vec3{ 3.0f, 2.0f, 0.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(loose).position(), Vec3{ 5.0f, 0.0f, 0.0f }));
+		BYTE_CHECK(!view.get<Transform>(loose).changed());
+
+		world.get<Transform>(child).position(Vec3{ 0.0f, 0.0f, 0.0f });
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).local().position, Vec3{ -0.5f, 0.0f, 0.0f }));
+		world.get<Transform>(root).localPosition(Vec3{ 2.0f, 0.0f, 0.0f });
+		world.nextTick();
+		system.update(world, pool);
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).position(), Vec3{ 1.0f, 0.0f, 0.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(grandchild).position(), Vec3{ 1.0f, 2.0f, 0.0f }));
+
+		world.get<Transform>(root).localRotation(Quaternion{ Vec3{ 0.0f, 90.0f, 0.0f } });
+		world.nextTick();
+		system.update(world);
+		world.get<Transform>(child).rotation(Quaternion{});
+		world.get<Transform>(child).scale(Vec3{ 1.0f, 1.0f, 1.0f });
+		world.nextTick();
+		system.update(world);
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).front(), Vec3{ 0.0f, 0.0f, -1.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).scale(), Vec3{ 1.0f, 1.0f, 1.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(grandchild).position(), view.get<Transform>(child).position() + Vec3{ 0.0f, 1.0f, 0.0f }));
+	}
+
+	BYTE_TEST(hierarchyReparent) {
+		World world;
+		Hierarchy<World> hierarchy{ world };
+		TransformSystem system{ hierarchy };
+
+		EntityID parent{ world.create(Transform{}) };
+		EntityID child{ world.create(Transform{}) };
+		EntityID grandchild{ world.create(Transform{}) };
+		world.get<Transform>(parent).localPosition(Vec3{ 10.0f, 0.0f, 0.0f });
+		world.get<Transform>(child).localPosition(Vec3{ 1.0f, 0.0f, 0.0f });
+		world.get<Transform>(grandchild).localPosition(Vec3{ 0.0f, 1.0f, 0.0f });
+		hierarchy.attach(grandchild, child);
+		world.nextTick();
+		system.update(world);
+
+		const World& view{ world };
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).position(), Vec3{ 1.0f, 0.0f, 0.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(grandchild).position(), Vec3{ 1.0f, 1.0f, 0.0f }));
+
+		hierarchy.attach(child, parent);
+		world.nextTick();
+		system.update(world);
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).position(), Vec3{ 11.0f, 0.0f, 0.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(grandchild).position(), Vec3{ 11.0f, 1.0f, 0.0f }));
+
+		hierarchy.detach(child);
+		world.nextTick();
+		system.update(world);
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(child).position(), Vec3{ 1.0f, 0.0f, 0.0f }));
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(grandchild).position(), Vec3{ 1.0f, 1.0f, 0.0f }));
+
+		hierarchy.detach(grandchild);
+		world.nextTick();
+		system.update(world);
+		BYTE_CHECK(nearlyEqual(view.get<Transform>(grandchild).position(), Vec3{ 0.0f, 1.0f, 0.0f }));
+	}
+
+}
\ No newline at end of file
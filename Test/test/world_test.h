@@ -0,0 +1,176 @@
+#pragma once
+
+#include <vector>
+
+#include "ecs/ecs.h"
+#include "test.h"
+
+namespace Byte {
+
+	struct TestPosition {
+		float x{};
+	};
+
+	struct TestVelocity {
+		float x{};
+	};
+
+	template<typename WorldType>
+	void checkMissingComponentVersion() {
+		WorldType world;
+		EntityID moving{ world.create(TestPosition{}, TestVelocity{}) };
+		EntityID still{ world.create(TestPosition{}) };
+
+		uint64_t tick{ world.nextTick() };
+		world.template modified<TestVelocity>(still);
+		world.template modified<TestVelocity>(moving);
+
+		size_t count{};
+		for ([[maybe_unused]] auto [position] : world.template components<TestPosition>().template changedSince<TestVelocity>(tick - 1)) {
+			++count;
+		}
+		BYTE_CHECK(count == 1);
+
+		world.nextTick();
+		count = 0;
+		for ([[maybe_unused]] auto [position] : world.template components<TestPosition>().template changedSince<TestVelocity>(tick)) {
+			++count;
+		}
+		BYTE_CHECK(count == 0);
+		BYTE_CHECK(world.contains(still));
+	}
+
+	BYTE_TEST(missingComponentVersion) {
+		checkMissingComponentVersion<VectorWorld>();
+		checkMissingComponentVersion<World>();
+	}
+
+	template<typename WorldType>
+	void checkCopyDropsObservers() {
+		WorldType world;
+		size_t added{};
+		world.template onAdd<TestVelocity>([&](WorldType&, const auto& ids) {
+			added += ids.size();
+		});
+
+		auto first{ world.create(TestPosition{}) };
+		auto second{ world.create(TestPosition{}) };
+		world.attach(first, TestVelocity{});
+
+		WorldType snapshot{ world };
+		BYTE_CHECK(snapshot.stats().total.creates == 2);
+
+		snapshot.attach(second, TestVelocity{});
+		snapshot.dispatch();
+		BYTE_CHECK(added == 0);
+
+		world.dispatch();
+		BYTE_CHECK(added == 1);
+	}
+
+	BYTE_TEST(copyDropsObservers) {
+		checkCopyDropsObservers<VectorWorld>();
+		checkCopyDropsObservers<World>();
+	}
+
+	template<typename WorldType>
+	void checkCompactEdges() {
+		WorldType world;
+		auto moving{ world.create(TestPosition{ 1.0f }) };
+		auto flying{ world.create(TestVelocity{ 2.0f }) };
+		world.attach(flying, TestPosition{ 3.0f });
+		world.attach(moving, TestVelocity{ 4.0f });
+		world.template detach<TestVelocity>(moving);
+		world.template detach<TestPosition>(flying);
+		world.compact();
+
+		world.attach(moving, TestVelocity{ 5.0f });
+		world.attach(flying, TestPosition{ 6.0f });
+		BYTE_CHECK(world.template get<TestPosition>(moving).x == 1.0f);
+		BYTE_CHECK(world.template get<TestVelocity>(moving).x == 5.0f);
+		BYTE_CHECK(world.template get<TestPosition>(flying).x == 6.0f);
+		BYTE_CHECK(world.template get<TestVelocity>(flying).x == 2.0f);
+		BYTE_CHECK(world.stats().archetypes == 3);
+	}
+
+	BYTE_TEST(compactEdges) {
+		checkCompactEdges<VectorWorld>();
+		checkCompactEdges<World>();
+	}
+
+	template<typename WorldType>
+	void checkEdgeTransitions() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		std::vector<EntityID> ids;
+		for (size_t _index{}; _index < 100; ++_index) {
+			ids.push_back(world.create(TestPosition{ static_cast<float>(_index) }));
+		}
+
+		for (size_t cycle{}; cycle < 3; ++cycle) {
+			for (EntityID id : ids) {
+				world.attach(id, TestVelocity{ static_cast<float>(cycle) });
+			}
+			BYTE_CHECK(world.stats().archetypes == 2);
+
+			for (EntityID id : ids) {
+				world.template detach<TestVelocity>(id);
+			}
+			BYTE_CHECK(world.stats().archetypes == 2);
+		}
+
+		world.attach(ids.front(), TestVelocity{ 7.0f });
+		world.template detach<TestPosition>(ids.front());
+		BYTE_CHECK(world.stats().archetypes == 3);
+		BYTE_CHECK(world.template get<TestVelocity>(ids.front()).x == 7.0f);
+
+		for (size_t _index{ 1 }; _index < ids.size(); ++_index) {
+			BYTE_CHECK(world.template get<TestPosition>(ids[_index]).x == static_cast<float>(_index));
+			BYTE_CHECK(!world.template has<TestVelocity>(ids[_index]));
+		}
+	}
+
+	BYTE_TEST(edgeTransitions) {
+		checkEdgeTransitions<VectorWorld>();
+		checkEdgeTransitions<World>();
+	}
+
+	template<typename WorldType>
+	void checkMissingDetach() {
+		using EntityID = typename WorldType::EntityID;
+
+		WorldType world;
+		EntityID empty{ world.create() };
+		EntityID first{ world.create(TestPosition{ 1.0f }) };
+		EntityID second{ world.create(TestPosition{ 2.0f }) };
+
+		auto before{ world.stats() };
+		world.template detach<TestVelocity>(empty);
+		world.template detach<TestVelocity>(first);
+		world.template detach<TestVelocity>(first);
+		auto after{ world.stats() };
+		BYTE_CHECK(after.archetypes == before.archetypes);
+		BYTE_CHECK(after.total.moves == before.total.moves);
+		BYTE_CHECK(after.total.detaches == before.total.detaches);
+
+		world.attach(second, TestVelocity{ 3.0f });
+		world.attach(first, TestVelocity{ 4.0f });
+		BYTE_CHECK(world.template get<TestPosition>(first).x == 1.0f);
+		BYTE_CHECK(world.template get<TestVelocity>(first).x == 4.0f);
+		BYTE_CHECK(world.template get<TestPosition>(second).x == 2.0f);
+		BYTE_CHECK(world.template get<TestVelocity>(second).x == 3.0f);
+		BYTE_CHECK(world.contains(empty));
+
+		world.template detach<TestVelocity>(second);
+		world.template detach<TestVelocity>(second);
+		BYTE_CHECK(!world.template has<TestVelocity>(second));
+		BYTE_CHECK(world.template get<TestPosition>(second).x == 2.0f);
+	}
+
+	BYTE_TEST(missingDetach) {
+		checkMissingDetach<VectorWorld>();
+		checkMissingDetach<World>();
+	}
+
+}
\ No newline at end of file